@@ -1,6 +1,6 @@
-package require vtkmycommon
-package require vtkmyimaging
-package require vtkmyunsorted
-
-package provide vtkmy 4.0
-
+package require vtkmycommon
+package require vtkmyimaging
+package require vtkmyunsorted
+
+package provide vtkmy 4.0
+
@@ -1,65 +1,65 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "hostbitmap.h"
-#include "buffers.h"
-
-namespace ExposureRender
-{
-
-/*! Bitmap class */
-class Bitmap : public TimeStamp
-{
-public:
-	/*! Default constructor */
-	HOST Bitmap() :
-		TimeStamp(),
-		Pixels("Device Pixels", Enums::Device)
-	{
-	}
-	
-	/*! Copy constructor
-		@param[in] Other Bitmap to copy
-	*/
-	HOST Bitmap(const HostBitmap& Other) :
-		TimeStamp(),
-		Pixels("Device Pixels", Enums::Device)
-	{
-		*this = Other;
-	}
-
-	/*! Assignment operator
-		@param[in] Other Bitmap to copy
-		@return Copied bitmap
-	*/
-	HOST Bitmap& operator = (const HostBitmap& Other)
-	{
-		TimeStamp::operator = (Other);
-
-		this->Pixels = Other.GetPixels();
-
-		return *this;
-	}
-
-	GET_REF_MACRO(HOST_DEVICE, Pixels, Buffer2D<ColorRGBAuc>)
-
-protected:
-	Buffer2D<ColorRGBAuc> Pixels;		/*! Buffer for pixels */
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "hostbitmap.h"
+#include "buffers.h"
+
+namespace ExposureRender
+{
+
+/*! Bitmap class */
+class Bitmap : public TimeStamp
+{
+public:
+	/*! Default constructor */
+	HOST Bitmap() :
+		TimeStamp(),
+		Pixels("Device Pixels", Enums::Device)
+	{
+	}
+	
+	/*! Copy constructor
+		@param[in] Other Bitmap to copy
+	*/
+	HOST Bitmap(const HostBitmap& Other) :
+		TimeStamp(),
+		Pixels("Device Pixels", Enums::Device)
+	{
+		*this = Other;
+	}
+
+	/*! Assignment operator
+		@param[in] Other Bitmap to copy
+		@return Copied bitmap
+	*/
+	HOST Bitmap& operator = (const HostBitmap& Other)
+	{
+		TimeStamp::operator = (Other);
+
+		this->Pixels = Other.GetPixels();
+
+		return *this;
+	}
+
+	GET_REF_MACRO(HOST_DEVICE, Pixels, Buffer2D<ColorRGBAuc>)
+
+protected:
+	Buffer2D<ColorRGBAuc> Pixels;		/*! Buffer for pixels */
+};
+
+}
@@ -0,0 +1,412 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "hostvolume.h"
+#include "buffer1d.h"
+#include "buffer3d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "volumepyramid.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+#include <algorithm>
+
+namespace ExposureRender
+{
+
+#define BRICK_CACHE_BRICK_SIZE_LOG2		5
+#define BRICK_CACHE_BRICK_SIZE			(1 << BRICK_CACHE_BRICK_SIZE_LOG2)
+#define BRICK_CACHE_SLOT_SIZE			(BRICK_CACHE_BRICK_SIZE + 1)
+#define BRICK_CACHE_MAX_LOADS			1024
+#define BRICK_CACHE_SLOT_VOXELS			(BRICK_CACHE_SLOT_SIZE * BRICK_CACHE_SLOT_SIZE * BRICK_CACHE_SLOT_SIZE)
+#define BRICK_CACHE_MAX_SLOTS			(INT_MAX / BRICK_CACHE_SLOT_VOXELS)
+
+/*! \class BrickCache
+ * \brief Streams the voxels of a volume that exceeds its memory budget. The volume is divided into bricks which are copied on demand from the (memory mapped) source voxels into a fixed number of cache slots, every slot holds one extra voxel along each axis so that a cell never straddles two slots. Samples in bricks that are not resident fall back to a coarse, box filtered copy of the volume which always stays resident. Misses are collected while rendering and served between frames, where the least recently used bricks are evicted
+ */
+class EXPOSURE_RENDER_DLL BrickCache
+{
+public:
+	/*! Default constructor */
+	HOST BrickCache() :
+		Resolution(),
+		NoBricks(),
+		Budget(0.0f),
+		NoSlots(0),
+		Slots("Device Brick Slots", Enums::Device),
+		PageTable("Device Brick Page Table", Enums::Device),
+		Touched("Device Touched Bricks", Enums::Device),
+		Coarse("Device Coarse Voxels", Enums::Device),
+		CoarseOffsets("Device Coarse Voxel Offsets", Enums::Device),
+		CoarseFactor(1),
+		SlotBricks("Host Slot Bricks", Enums::Host),
+		LastUsed("Host Brick Last Used", Enums::Host),
+		Frame(0),
+		pSource(NULL),
+		SourceFile()
+	{
+	}
+
+	/*! Gets whether the voxels of \a Other must be streamed to stay within its streaming budget, only unsigned short voxels are streamed
+		@param[in] Other Host volume
+		@return Whether the voxels must be streamed
+	*/
+	HOST static bool Required(const HostVolume& Other)
+	{
+		const long long NoBytes = (long long)Other.Voxels.GetResolution()[0] * Other.Voxels.GetResolution()[1] * Other.Voxels.GetResolution()[2] * sizeof(unsigned short);
+
+		return Other.GetVoxelType() == Enums::UnsignedShort && Other.GetStreamingBudget() > 0.0f && (float)NoBytes > Other.GetStreamingBudget() * 1024.0f * 1024.0f;
+	}
+
+	/*! Creates the cache for the voxels of \a Other, an eighth of the streaming budget goes to the coarse copy and the rest to the slots
+		@param[in] Other Host volume with memory mapped voxels, the cache keeps the mapping alive
+	*/
+	HOST void Create(const HostVolume& Other)
+	{
+		this->Free();
+
+		this->Resolution	= Other.Voxels.GetResolution();
+		this->pSource		= Other.Voxels.GetData();
+		this->SourceFile	= Other.VoxelFile;
+		this->Budget		= Other.GetStreamingBudget();
+
+		const float Budget = this->Budget * 1024.0f * 1024.0f;
+
+		// Coarsen until the coarse copy fits in an eighth of the budget
+		this->CoarseFactor = 2;
+
+		while (this->CoarseFactor < this->Resolution.Max() && (float)this->GetCoarseResolution(this->CoarseFactor).LongCumulativeProduct() * sizeof(unsigned short) > 0.125f * Budget)
+			this->CoarseFactor *= 2;
+
+		const Vec3i CoarseResolution = this->GetCoarseResolution(this->CoarseFactor);
+
+		for (int i = 0; i < 3; i++)
+			this->NoBricks[i] = (this->Resolution[i] + BRICK_CACHE_BRICK_SIZE - 1) >> BRICK_CACHE_BRICK_SIZE_LOG2;
+
+		const int NoBricks = this->NoBricks.CumulativeProduct();
+
+		// The slots share one buffer whose element count has to fit an int, which caps the slots at about four gigabytes
+		this->NoSlots = (int)min((float)min(NoBricks, BRICK_CACHE_MAX_SLOTS), max(1.0f, 0.875f * Budget / (float)(BRICK_CACHE_SLOT_VOXELS * sizeof(unsigned short))));
+
+		this->Slots.Resize(Vec<int, 1>(this->NoSlots * BRICK_CACHE_SLOT_VOXELS));
+		this->Touched.Resize(Vec<int, 1>(NoBricks));
+
+		Buffer1D<int> PageTable("Host Brick Page Table", Enums::Host);
+
+		PageTable.Resize(Vec<int, 1>(NoBricks));
+
+		for (int i = 0; i < NoBricks; i++)
+			PageTable[i] = -1;
+
+		this->PageTable.Set(Enums::Host, PageTable.GetResolution(), PageTable.GetData());
+
+		this->SlotBricks.Resize(Vec<int, 1>(this->NoSlots));
+
+		for (int i = 0; i < this->NoSlots; i++)
+			this->SlotBricks[i] = -1;
+
+		this->LastUsed.Resize(Vec<int, 1>(NoBricks));
+
+		this->Frame = 0;
+
+		this->BuildCoarse(CoarseResolution);
+	}
+
+	/*! Releases the slots, the coarse copy and the source voxels */
+	HOST void Free()
+	{
+		this->Resolution	= Vec3i();
+		this->NoBricks		= Vec3i();
+		this->Budget		= 0.0f;
+		this->NoSlots		= 0;
+		this->pSource		= NULL;
+
+		this->Slots.Free();
+		this->PageTable.Free();
+		this->Touched.Free();
+		this->Coarse.Free();
+		this->CoarseOffsets.Free();
+		this->SlotBricks.Free();
+		this->LastUsed.Free();
+		this->SourceFile.reset();
+	}
+
+	/*! Serves the misses of the previous frame, bricks are only evicted when they were not used in the previous frame so that the working set never thrashes. Must be called between frames
+		@return Whether bricks became resident, samples of the previous frame may have fallen back to the coarse copy
+	*/
+	HOST bool Update()
+	{
+		if (this->NoSlots <= 0)
+			return false;
+
+		this->Frame++;
+
+		const int NoBricks = this->NoBricks.CumulativeProduct();
+
+		Buffer1D<int> PageTable("Host Brick Page Table", Enums::Host);
+		Buffer1D<unsigned char> Touched("Host Touched Bricks", Enums::Host);
+
+		PageTable.Set(Enums::Device, this->PageTable.GetResolution(), this->PageTable.GetData());
+		Touched.Set(Enums::Device, this->Touched.GetResolution(), this->Touched.GetData());
+
+		std::vector<int> Misses;
+
+		for (int i = 0; i < NoBricks; i++)
+		{
+			if (!Touched[i])
+				continue;
+
+			this->LastUsed[i] = this->Frame;
+
+			if (PageTable[i] < 0 && (int)Misses.size() < BRICK_CACHE_MAX_LOADS)
+				Misses.push_back(i);
+		}
+
+		// Start every frame with no touched bricks, otherwise bricks sampled long ago keep their last used frame fresh
+		this->Touched.Reset();
+
+		if (Misses.empty())
+			return false;
+
+		// Free slots come first, then slots of the least recently used bricks
+		std::vector<std::pair<int, int> > Victims;
+
+		for (int i = 0; i < this->NoSlots; i++)
+		{
+			const int Brick = this->SlotBricks[i];
+
+			const int LastUsed = Brick >= 0 ? this->LastUsed[Brick] : -1;
+
+			if (LastUsed < this->Frame)
+				Victims.push_back(std::make_pair(LastUsed, i));
+		}
+
+		const int NoLoads = min((int)Misses.size(), (int)Victims.size());
+
+		if (NoLoads <= 0)
+			return false;
+
+		std::partial_sort(Victims.begin(), Victims.begin() + NoLoads, Victims.end());
+
+		for (int i = 0; i < NoLoads; i++)
+		{
+			const int Slot = Victims[i].second;
+
+			if (this->SlotBricks[Slot] >= 0)
+				PageTable[this->SlotBricks[Slot]] = -1;
+
+			this->SlotBricks[Slot]	= Misses[i];
+			PageTable[Misses[i]]	= Slot;
+		}
+
+		const auto LoadBrick = [&](int i)
+		{
+			this->LoadBrick(Misses[i], Victims[i].second);
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(NoLoads, LoadBrick);
+#else
+		for (int i = 0; i < NoLoads; i++)
+			LoadBrick(i);
+#endif
+
+		this->PageTable.Set(Enums::Host, PageTable.GetResolution(), PageTable.GetData());
+
+		return true;
+	}
+
+	/*! Gets whether the cache streams voxels
+		@return Whether the cache is in use
+	*/
+	HOST_DEVICE bool GetEnabled() const
+	{
+		return this->NoSlots > 0;
+	}
+
+	/*! Fetches voxel data at \a UVW with the same semantics as VoxelSampler, falls back to the coarse copy when the brick is not resident
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@param[in] Nearest Whether to fetch the nearest voxel instead of interpolating
+		@return Data at \a UVW
+	*/
+	HOST_DEVICE float Fetch(const Vec3f& UVW, const bool& Nearest) const
+	{
+		int Base[3], Step[3];
+		unsigned int Weight[3];
+
+		for (int i = 0; i < 3; i++)
+		{
+			const int Max = this->Resolution[i] - 1;
+
+			if (Nearest)
+			{
+				Base[i]		= Clamp((int)floorf(UVW[i] + 0.5f), 0, Max);
+				Weight[i]	= 0;
+			}
+			else
+			{
+				VoxelSampler::Locate(UVW[i], (float)Max, max(Max - 1, 0), Base[i], Weight[i]);
+			}
+
+			Step[i] = Max > 0 ? 1 : 0;
+		}
+
+		const int Brick = ((Base[2] >> BRICK_CACHE_BRICK_SIZE_LOG2) * this->NoBricks[1] + (Base[1] >> BRICK_CACHE_BRICK_SIZE_LOG2)) * this->NoBricks[0] + (Base[0] >> BRICK_CACHE_BRICK_SIZE_LOG2);
+
+		unsigned char* pTouched = this->Touched.GetData() + Brick;
+
+		if (!*pTouched)
+			*pTouched = 1;
+
+		const int Slot = this->PageTable.GetData()[Brick];
+
+		if (Slot < 0)
+			return this->FetchCoarse(UVW, Nearest);
+
+		const unsigned short* pV = this->Slots.GetData() + (long long)Slot * BRICK_CACHE_SLOT_VOXELS;
+
+		const int Mask = BRICK_CACHE_BRICK_SIZE - 1;
+
+		const int X0 = Base[0] & Mask;
+		const int Y0 = (Base[1] & Mask) * BRICK_CACHE_SLOT_SIZE;
+		const int Z0 = (Base[2] & Mask) * BRICK_CACHE_SLOT_SIZE * BRICK_CACHE_SLOT_SIZE;
+
+		if (Nearest)
+			return (float)pV[Z0 + Y0 + X0];
+
+		const int X[2] = { X0, X0 + Step[0] };
+		const int Y[2] = { Y0, Y0 + Step[1] * BRICK_CACHE_SLOT_SIZE };
+		const int Z[2] = { Z0, Z0 + Step[2] * BRICK_CACHE_SLOT_SIZE * BRICK_CACHE_SLOT_SIZE };
+
+		return (float)VoxelSampler::Trilinear(pV, X, Y, Z, Weight[0], Weight[1], Weight[2]) * (1.0f / 65536.0f);
+	}
+
+	/*! Fetches voxel data at \a UVW from the coarse copy
+		@param[in] UVW Voxel coordinates of the full resolution volume
+		@param[in] Nearest Whether to fetch the nearest voxel instead of interpolating
+		@return Data at \a UVW
+	*/
+	HOST_DEVICE float FetchCoarse(const Vec3f& UVW, const bool& Nearest) const
+	{
+		const float InvFactor = 1.0f / (float)this->CoarseFactor;
+
+		const Vec3f CoarseUVW((UVW[0] + 0.5f) * InvFactor - 0.5f, (UVW[1] + 0.5f) * InvFactor - 0.5f, (UVW[2] + 0.5f) * InvFactor - 0.5f);
+
+		const VoxelSampler Sampler(this->Coarse.GetData(), this->CoarseOffsets.GetData(), this->Coarse.GetResolution());
+
+		return Nearest ? (float)Sampler.Nearest(CoarseUVW) : Sampler(CoarseUVW);
+	}
+
+	GET_MACRO(HOST_DEVICE, Budget, float)
+	GET_MACRO(HOST_DEVICE, NoSlots, int)
+	GET_MACRO(HOST_DEVICE, CoarseFactor, int)
+
+protected:
+	/*! Gets the resolution of the coarse copy for \a Factor
+		@param[in] Factor Number of voxels per coarse voxel along each axis
+		@return Coarse resolution
+	*/
+	HOST Vec3i GetCoarseResolution(const int& Factor) const
+	{
+		return Vec3i((this->Resolution[0] + Factor - 1) / Factor, (this->Resolution[1] + Factor - 1) / Factor, (this->Resolution[2] + Factor - 1) / Factor);
+	}
+
+	/*! Box filters the source voxels into the coarse copy
+		@param[in] CoarseResolution Resolution of the coarse copy
+	*/
+	HOST void BuildCoarse(const Vec3i& CoarseResolution)
+	{
+		Buffer3D<unsigned short> Coarse("Host Coarse Voxels", Enums::Host);
+
+		Coarse.Resize(CoarseResolution);
+
+		DownsampleVoxels(VoxelSource(this->pSource, this->Resolution), this->CoarseFactor, Coarse.GetData());
+
+		this->Coarse.Set(Enums::Host, Coarse.GetResolution(), Coarse.GetData());
+
+		Buffer1D<int> CoarseOffsets("Host Coarse Voxel Offsets", Enums::Host);
+
+		CoarseOffsets.Resize(Vec<int, 1>(CoarseResolution[0] + CoarseResolution[1] + CoarseResolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(Enums::Scanline, CoarseResolution, StorageResolution, CoarseOffsets.GetData());
+
+		this->CoarseOffsets.Set(Enums::Host, CoarseOffsets.GetResolution(), CoarseOffsets.GetData());
+	}
+
+	/*! Copies a brick and its extra voxels from the source into a slot, voxels beyond the volume repeat the border
+		@param[in] Brick Brick index
+		@param[in] Slot Slot index
+	*/
+	HOST void LoadBrick(const int& Brick, const int& Slot)
+	{
+		const int Origin[3] =
+		{
+			(Brick % this->NoBricks[0]) << BRICK_CACHE_BRICK_SIZE_LOG2,
+			((Brick / this->NoBricks[0]) % this->NoBricks[1]) << BRICK_CACHE_BRICK_SIZE_LOG2,
+			(Brick / (this->NoBricks[0] * this->NoBricks[1])) << BRICK_CACHE_BRICK_SIZE_LOG2
+		};
+
+		const int Width = min(BRICK_CACHE_SLOT_SIZE, this->Resolution[0] - Origin[0]);
+
+		unsigned short* pSlot = this->Slots.GetData() + (long long)Slot * BRICK_CACHE_SLOT_VOXELS;
+
+		for (int z = 0; z < BRICK_CACHE_SLOT_SIZE; z++)
+		{
+			const int Z = min(Origin[2] + z, this->Resolution[2] - 1);
+
+			for (int y = 0; y < BRICK_CACHE_SLOT_SIZE; y++)
+			{
+				const int Y = min(Origin[1] + y, this->Resolution[1] - 1);
+
+				const unsigned short* pRow = this->pSource + ((long long)Z * this->Resolution[1] + Y) * this->Resolution[0] + Origin[0];
+
+				unsigned short* pSlotRow = pSlot + (z * BRICK_CACHE_SLOT_SIZE + y) * BRICK_CACHE_SLOT_SIZE;
+
+				memcpy(pSlotRow, pRow, Width * sizeof(unsigned short));
+
+				for (int x = Width; x < BRICK_CACHE_SLOT_SIZE; x++)
+					pSlotRow[x] = pRow[Width - 1];
+			}
+		}
+	}
+
+	Vec3i							Resolution;			/*! Resolution of the volume */
+	Vec3i							NoBricks;			/*! Number of bricks along each axis */
+	float							Budget;				/*! Memory budget in megabytes */
+	int								NoSlots;			/*! Number of cache slots, zero when the voxels are not streamed */
+	Buffer1D<unsigned short>		Slots;				/*! Voxels of the cached bricks, BRICK_CACHE_SLOT_SIZE^3 per slot */
+	Buffer1D<int>					PageTable;			/*! Slot of every brick, -1 when the brick is not resident */
+	Buffer1D<unsigned char>			Touched;			/*! Whether a brick was sampled since the last update */
+	Buffer3D<unsigned short>		Coarse;				/*! Resident box filtered copy of the volume */
+	Buffer1D<int>					CoarseOffsets;		/*! Offset tables of the coarse copy */
+	int								CoarseFactor;		/*! Number of voxels per coarse voxel along each axis */
+	Buffer1D<int>					SlotBricks;			/*! Brick in every slot, -1 when the slot is free */
+	Buffer1D<int>					LastUsed;			/*! Frame in which every brick was last sampled */
+	int								Frame;				/*! Number of updates */
+	const unsigned short*			pSource;			/*! Scanline ordered source voxels */
+	std::shared_ptr<MappedFile>		SourceFile;			/*! Memory mapped file of the source voxels */
+};
+
+}
@@ -0,0 +1,229 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer1d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "transferfunction1d.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+typedef BasicVoxelSampler<const unsigned char*> ClassifiedVoxelSampler8;
+typedef BasicVoxelSampler<const unsigned short*> ClassifiedVoxelSampler16;
+
+/*! \class ClassifiedVoxels
+ * \brief Opacity of every voxel under the opacity transfer function, stored with 8 or 16 bits relative to the largest opacity of the transfer function. Sampling interpolates the classified opacities (pre-classification), so a marcher needs one fetch and no transfer function evaluation per step. Across sharp transitions of the transfer function interpolated opacities differ from the opacity of interpolated intensities
+ */
+class EXPOSURE_RENDER_DLL ClassifiedVoxels
+{
+public:
+	/*! Default constructor */
+	HOST ClassifiedVoxels() :
+		Resolution(),
+		Scale(0.0f),
+		Opacities8("Device Classified Opacities 8", Enums::Device),
+		Opacities16("Device Classified Opacities 16", Enums::Device),
+		Offsets("Device Classified Voxel Offsets", Enums::Device)
+	{
+	}
+
+	/*! Classifies the voxels \a Sampler reads under \a Opacity
+		@param[in] Sampler Sampler of the 16-bit voxels, in any voxel layout
+		@param[in] Resolution Resolution of the voxels
+		@param[in] Opacity Opacity transfer function
+		@param[in] Classification Precision of the classified opacities, PreClassification8Bit or PreClassification16Bit
+	*/
+	template<class T>
+	HOST void Set(const BasicVoxelSampler<T>& Sampler, const Vec3i& Resolution, const ScalarTransferFunction1D& Opacity, const Enums::OpacityClassification& Classification)
+	{
+		this->Resolution = Resolution;
+
+		const int MaxCode = Classification == Enums::PreClassification8Bit ? UCHAR_MAX : USHRT_MAX;
+
+		// The renderer truncates intensities before evaluating the opacity, so every voxel maps to one of the codes of this table
+		std::vector<float> Opacities(USHRT_MAX + 1);
+
+		float MaxOpacity = 0.0f;
+
+		for (int i = 0; i <= USHRT_MAX; i++)
+		{
+			Opacities[i]	= max(Opacity.Evaluate((float)i), 0.0f);
+			MaxOpacity		= max(MaxOpacity, Opacities[i]);
+		}
+
+		this->Scale = MaxOpacity / (float)MaxCode;
+
+		const float InvScale = this->Scale > 0.0f ? 1.0f / this->Scale : 0.0f;
+
+		std::vector<unsigned short> Codes(USHRT_MAX + 1);
+
+		for (int i = 0; i <= USHRT_MAX; i++)
+			Codes[i] = (unsigned short)min(Opacities[i] * InvScale + 0.5f, (float)MaxCode);
+
+		Buffer1D<int> Offsets("Host Classified Voxel Offsets", Enums::Host);
+
+		Offsets.Resize(Vec<int, 1>(Resolution[0] + Resolution[1] + Resolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(Enums::Scanline, Resolution, StorageResolution, Offsets.GetData());
+
+		if (Classification == Enums::PreClassification8Bit)
+		{
+			this->Opacities16.Free();
+			this->Classify(Sampler, Codes, this->Opacities8);
+		}
+		else
+		{
+			this->Opacities8.Free();
+			this->Classify(Sampler, Codes, this->Opacities16);
+		}
+
+		this->Offsets.Set(Enums::Host, Offsets.GetResolution(), Offsets.GetData());
+	}
+
+	/*! Releases the classified opacities */
+	HOST void Free()
+	{
+		this->Resolution	= Vec3i();
+		this->Scale			= 0.0f;
+
+		this->Opacities8.Free();
+		this->Opacities16.Free();
+		this->Offsets.Free();
+	}
+
+	/*! Gets whether opacities have been classified
+		@return Whether opacities can be sampled
+	*/
+	HOST_DEVICE bool GetEnabled() const
+	{
+		return this->Opacities8.GetNoElements() > 0 || this->Opacities16.GetNoElements() > 0;
+	}
+
+	/*! Gets the precision of the classified opacities
+		@return Classification, PostClassification when no opacities have been classified
+	*/
+	HOST Enums::OpacityClassification GetClassification() const
+	{
+		if (this->Opacities8.GetNoElements() > 0)
+			return Enums::PreClassification8Bit;
+
+		return this->Opacities16.GetNoElements() > 0 ? Enums::PreClassification16Bit : Enums::PostClassification;
+	}
+
+	/*! Fetches the opacity at \a UVW
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@param[in] Nearest Whether to fetch the nearest voxel instead of interpolating
+		@return Opacity at \a UVW
+	*/
+	HOST_DEVICE float Fetch(const Vec3f& UVW, const bool& Nearest) const
+	{
+		if (this->Opacities8.GetNoElements() > 0)
+			return FetchVisitor(UVW, Nearest)(ClassifiedVoxelSampler8(this->Opacities8.GetData(), this->Offsets.GetData(), this->Resolution)) * this->Scale;
+
+		return FetchVisitor(UVW, Nearest)(ClassifiedVoxelSampler16(this->Opacities16.GetData(), this->Offsets.GetData(), this->Resolution)) * this->Scale;
+	}
+
+protected:
+	/*! Writes the code of every voxel \a Sampler reads to \a Opacities
+		@param[in] Sampler Sampler of the 16-bit voxels
+		@param[in] Codes Code per intensity
+		@param[out] Opacities Scanline ordered codes
+	*/
+	template<class T, class C>
+	HOST void Classify(const BasicVoxelSampler<T>& Sampler, const std::vector<unsigned short>& Codes, Buffer1D<C>& Opacities)
+	{
+		const Vec3i& Resolution = this->Resolution;
+
+		Buffer1D<C> Classified("Host Classified Opacities", Enums::Host);
+
+		Classified.Resize(Vec<int, 1>(Resolution.CumulativeProduct()));
+
+		const auto ClassifySlice = [&](int Z)
+		{
+			C* pSlice = Classified.GetData() + Z * Resolution[0] * Resolution[1];
+
+			for (int Y = 0; Y < Resolution[1]; Y++)
+			{
+				for (int X = 0; X < Resolution[0]; X++)
+				{
+					const int XYZ[3] = { X, Y, Z };
+
+					pSlice[Y * Resolution[0] + X] = (C)Codes[Sampler.GetVoxel(XYZ)];
+				}
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(Resolution[2], ClassifySlice);
+#else
+		for (int Z = 0; Z < Resolution[2]; Z++)
+			ClassifySlice(Z);
+#endif
+
+		Opacities.Set(Enums::Host, Classified.GetResolution(), Classified.GetData());
+	}
+
+	Vec3i							Resolution;			/*! Resolution of the volume */
+	float							Scale;				/*! Opacity per code */
+	Buffer1D<unsigned char>			Opacities8;			/*! Scanline ordered 8-bit codes */
+	Buffer1D<unsigned short>		Opacities16;		/*! Scanline ordered 16-bit codes */
+	Buffer1D<int>					Offsets;			/*! Offset tables of the scanline voxel layout */
+};
+
+/*! Sampler visitor which classifies the voxels of the sampler */
+struct ClassifyVisitor
+{
+	typedef void Result;
+
+	/*! Constructor
+		@param[in] Classified Classified voxels to set
+		@param[in] Resolution Resolution of the volume
+		@param[in] Opacity Opacity transfer function
+		@param[in] Classification Precision of the classified opacities
+	*/
+	HOST ClassifyVisitor(ClassifiedVoxels& Classified, const Vec3i& Resolution, const ScalarTransferFunction1D& Opacity, const Enums::OpacityClassification& Classification) :
+		Classified(Classified),
+		Resolution(Resolution),
+		Opacity(Opacity),
+		Classification(Classification)
+	{
+	}
+
+	template<class T>
+	HOST void operator()(const BasicVoxelSampler<T>& Sampler) const
+	{
+		this->Classified.Set(Sampler, this->Resolution, this->Opacity, this->Classification);
+	}
+
+	ClassifiedVoxels&					Classified;			/*! Classified voxels to set */
+	Vec3i								Resolution;			/*! Resolution of the volume */
+	const ScalarTransferFunction1D&		Opacity;			/*! Opacity transfer function */
+	Enums::OpacityClassification		Classification;		/*! Precision of the classified opacities */
+};
+
+}
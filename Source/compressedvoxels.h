@@ -0,0 +1,246 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer1d.h"
+#include "buffer3d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define COMPRESSED_BRICK_NO_VOXELS_LOG2		(3 * VOXEL_BRICK_SIZE_LOG2)
+#define COMPRESSED_BRICK_NO_VOXELS			(1 << COMPRESSED_BRICK_NO_VOXELS_LOG2)
+
+/*! Compressed brick, the voxels of the brick are stored as offsets to the brick minimum with \a NoBits bits each */
+struct CompressedBrick
+{
+	unsigned int	Offset;			/*! Index of the first word of the bit packed offsets */
+	unsigned short	Min;			/*! Minimum voxel value of the brick */
+	unsigned short	NoBits;			/*! Number of bits per voxel, zero for uniform bricks */
+};
+
+/*! \class CompressedVoxelReader
+ * \brief Decodes single voxels of compressed bricks, voxel indices are those of the bricked voxel layout (see ComputeVoxelOffsets)
+ */
+class CompressedVoxelReader
+{
+public:
+	/*! Constructor
+		@param[in] pBricks Compressed bricks
+		@param[in] pWords Bit packed voxel offsets of all bricks
+	*/
+	HOST_DEVICE CompressedVoxelReader(const CompressedBrick* pBricks, const unsigned int* pWords) :
+		pBricks(pBricks),
+		pWords(pWords)
+	{
+	}
+
+	/*! Decodes voxel \a ID
+		@param[in] ID Voxel index in the bricked voxel layout
+		@return Voxel value
+	*/
+	HOST_DEVICE unsigned short operator[](const int& ID) const
+	{
+		const CompressedBrick& Brick = this->pBricks[ID >> COMPRESSED_BRICK_NO_VOXELS_LOG2];
+
+		const unsigned int Bit = (ID & (COMPRESSED_BRICK_NO_VOXELS - 1)) * Brick.NoBits;
+
+		// The words are padded so that the second word always exists
+		const unsigned int* pWord = this->pWords + Brick.Offset + (Bit >> 5);
+
+		const unsigned long long Window = pWord[0] | ((unsigned long long)pWord[1] << 32);
+
+		return Brick.Min + (unsigned short)((Window >> (Bit & 31)) & ((1u << Brick.NoBits) - 1));
+	}
+
+protected:
+	const CompressedBrick*	pBricks;		/*! Compressed bricks */
+	const unsigned int*		pWords;			/*! Bit packed voxel offsets */
+};
+
+typedef BasicVoxelSampler<CompressedVoxelReader> CompressedVoxelSampler;
+
+/*! \class CompressedVoxels
+ * \brief Voxels stored in bricks of VOXEL_BRICK_SIZE^3 as the brick minimum plus bit packed offsets, with as many bits as the range of the brick needs. Samplers decode the voxels they touch directly, every voxel can be decoded on its own so no decoded copy of a brick is needed
+ */
+class EXPOSURE_RENDER_DLL CompressedVoxels
+{
+public:
+	/*! Default constructor */
+	HOST CompressedVoxels() :
+		Resolution(),
+		Bricks("Device Compressed Bricks", Enums::Device),
+		Words("Device Compressed Words", Enums::Device),
+		Offsets("Device Compressed Voxel Offsets", Enums::Device)
+	{
+	}
+
+	/*! Compresses \a Voxels
+		@param[in] Voxels Scanline ordered voxels
+	*/
+	HOST void Set(const VoxelSource& Voxels)
+	{
+		this->Resolution = Voxels.GetResolution();
+
+		Buffer1D<int> Offsets("Host Compressed Voxel Offsets", Enums::Host);
+
+		Offsets.Resize(Vec<int, 1>(this->Resolution[0] + this->Resolution[1] + this->Resolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(Enums::Bricked, this->Resolution, StorageResolution, Offsets.GetData());
+
+		const Vec3i NoBricks(StorageResolution[0] / VOXEL_BRICK_SIZE, StorageResolution[1] / VOXEL_BRICK_SIZE, StorageResolution[2] / VOXEL_BRICK_SIZE);
+
+		std::vector<CompressedBrick> Bricks(NoBricks.CumulativeProduct());
+
+		const auto MeasureSlab = [&](int Z)
+		{
+			for (int Y = 0; Y < NoBricks[1]; Y++)
+			{
+				for (int X = 0; X < NoBricks[0]; X++)
+				{
+					unsigned short Min = USHRT_MAX, Max = 0;
+
+					VisitVoxelBrick(Voxels, X, Y, Z, [&](int, unsigned short Value)
+					{
+						Min = min(Min, Value);
+						Max = max(Max, Value);
+					});
+
+					CompressedBrick& Brick = Bricks[(Z * NoBricks[1] + Y) * NoBricks[0] + X];
+
+					Brick.Min		= Min;
+					Brick.NoBits	= 0;
+
+					while ((Max - Min) >> Brick.NoBits)
+						Brick.NoBits++;
+				}
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(NoBricks[2], MeasureSlab);
+#else
+		for (int Z = 0; Z < NoBricks[2]; Z++)
+			MeasureSlab(Z);
+#endif
+
+		// A brick of COMPRESSED_BRICK_NO_VOXELS voxels with n bits each occupies a whole number of words
+		unsigned int NoWords = 0;
+
+		for (size_t i = 0; i < Bricks.size(); i++)
+		{
+			Bricks[i].Offset	= NoWords;
+			NoWords				+= Bricks[i].NoBits * (COMPRESSED_BRICK_NO_VOXELS / 32);
+		}
+
+		Buffer1D<unsigned int> Words("Host Compressed Words", Enums::Host);
+
+		Words.Resize(Vec<int, 1>(NoWords + 1));
+
+		const auto PackSlab = [&](int Z)
+		{
+			for (int Y = 0; Y < NoBricks[1]; Y++)
+			{
+				for (int X = 0; X < NoBricks[0]; X++)
+				{
+					const CompressedBrick& Brick = Bricks[(Z * NoBricks[1] + Y) * NoBricks[0] + X];
+
+					if (Brick.NoBits == 0)
+						continue;
+
+					unsigned int* pWords = Words.GetData() + Brick.Offset;
+
+					VisitVoxelBrick(Voxels, X, Y, Z, [&](int ID, unsigned short Value)
+					{
+						const unsigned int Bit = ID * Brick.NoBits;
+
+						const unsigned long long Bits = (unsigned long long)(Value - Brick.Min) << (Bit & 31);
+
+						pWords[Bit >> 5] |= (unsigned int)Bits;
+
+						if (Bits >> 32)
+							pWords[(Bit >> 5) + 1] |= (unsigned int)(Bits >> 32);
+					});
+				}
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(NoBricks[2], PackSlab);
+#else
+		for (int Z = 0; Z < NoBricks[2]; Z++)
+			PackSlab(Z);
+#endif
+
+		this->Bricks.Set(Enums::Host, Vec<int, 1>((int)Bricks.size()), Bricks.data());
+		this->Words.Set(Enums::Host, Words.GetResolution(), Words.GetData());
+		this->Offsets.Set(Enums::Host, Offsets.GetResolution(), Offsets.GetData());
+	}
+
+	/*! Releases the compressed voxels */
+	HOST void Free()
+	{
+		this->Resolution = Vec3i();
+
+		this->Bricks.Free();
+		this->Words.Free();
+		this->Offsets.Free();
+	}
+
+	/*! Gets whether voxels have been compressed
+		@return Whether voxels can be sampled
+	*/
+	HOST_DEVICE bool GetEnabled() const
+	{
+		return this->Bricks.GetNoElements() > 0;
+	}
+
+	/*! Gets the size of the compressed voxels
+		@return Size in bytes
+	*/
+	HOST long long GetNoBytes() const
+	{
+		return (long long)this->Bricks.GetNoBytes() + this->Words.GetNoBytes() + this->Offsets.GetNoBytes();
+	}
+
+	/*! Gets a fixed point trilinear sampler which decodes the voxels
+		@return Voxel sampler
+	*/
+	HOST_DEVICE CompressedVoxelSampler GetSampler() const
+	{
+		return CompressedVoxelSampler(CompressedVoxelReader(this->Bricks.GetData(), this->Words.GetData()), this->Offsets.GetData(), this->Resolution);
+	}
+
+protected:
+	Vec3i							Resolution;			/*! Resolution of the volume */
+	Buffer1D<CompressedBrick>		Bricks;				/*! Compressed bricks in the order of the bricked voxel layout */
+	Buffer1D<unsigned int>			Words;				/*! Bit packed voxel offsets of all bricks, followed by a padding word */
+	Buffer1D<int>					Offsets;			/*! Offset tables of the bricked voxel layout */
+};
+
+}
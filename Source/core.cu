@@ -1,184 +1,394 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include <map>
-
-using namespace std;
-
-texture<unsigned short, 3, cudaReadModeNormalizedFloat> TexVolume0;
-texture<unsigned short, 3, cudaReadModeNormalizedFloat> TexVolume1;
-
-#include "color.h"
-
-map<int, int> gTracersHashMap;
-map<int, int> gVolumesHashMap;
-map<int, int> gObjectsHashMap;
-map<int, int> gClippingObjectsHashMap;
-map<int, int> gTexturesHashMap;
-map<int, int> gBitmapsHashMap;
-
-CONSTANT_DEVICE float gDensityScale			= 0.0f;
-CONSTANT_DEVICE float gStepFactorPrimary	= 0.0f;
-CONSTANT_DEVICE float gStepFactorShadow		= 0.0f;
-
-#include "statistics.h"
-#include "tracer.h"
-#include "volume.h"
-#include "object.h"
-#include "texture.h"
-#include "bitmap.h"
-
-DEVICE ExposureRender::Tracer*			gpTracer			= NULL;
-DEVICE ExposureRender::Volume* 			gpVolumes			= NULL;
-DEVICE ExposureRender::Object*			gpObjects			= NULL;
-DEVICE ExposureRender::Texture*			gpTextures			= NULL;
-DEVICE ExposureRender::Bitmap*			gpBitmaps			= NULL;
-
-#include "list.cuh"
-
-ExposureRender::Cuda::List<ExposureRender::Tracer, ExposureRender::HostTracer>					gTracers("gpTracer");
-ExposureRender::Cuda::List<ExposureRender::Volume, ExposureRender::HostVolume>					gVolumes("gpVolumes");
-ExposureRender::Cuda::List<ExposureRender::Object, ExposureRender::HostObject>					gObjects("gpObjects");
-ExposureRender::Cuda::List<ExposureRender::Texture, ExposureRender::HostTexture>				gTextures("gpTextures");
-ExposureRender::Cuda::List<ExposureRender::Bitmap, ExposureRender::HostBitmap>					gBitmaps("gpBitmaps");
-
-#include "autofocus.cuh"
-#include "render.cuh"
-
-namespace ExposureRender
-{
-
-EXPOSURE_RENDER_DLL void BindTracer(const HostTracer& Tracer, const bool& Bind /*= true*/)
-{
-	if (Bind)
-		gTracers.Bind(Tracer);
-	else
-		gTracers.Unbind(Tracer);
-
-	gTracersHashMap = gTracers.HashMap;
-}
-
-EXPOSURE_RENDER_DLL void BindVolume(const HostVolume& Volume, const bool& Bind /*= true*/)
-{
-	if (Bind)
-		gVolumes.Bind(Volume);
-	else
-		gVolumes.Unbind(Volume);
-
-	gVolumesHashMap = gVolumes.HashMap;
-}
-
-EXPOSURE_RENDER_DLL void BindObject(const HostObject& Object, const bool& Bind /*= true*/)
-{
-	if (Bind)
-		gObjects.Bind(Object);
-	else
-		gObjects.Unbind(Object);
-
-	gObjectsHashMap = gObjects.HashMap;
-}
-
-EXPOSURE_RENDER_DLL void BindTexture(const HostTexture& Texture, const bool& Bind /*= true*/)
-{
-	if (Bind)
-		gTextures.Bind(Texture);
-	else
-		gTextures.Unbind(Texture);
-
-	gTexturesHashMap = gTextures.HashMap;
-}
-
-EXPOSURE_RENDER_DLL void BindBitmap(const HostBitmap& Bitmap, const bool& Bind /*= true*/)
-{
-	if (Bind)
-		gBitmaps.Bind(Bitmap);
-	else
-		gBitmaps.Unbind(Bitmap);
-
-	gBitmapsHashMap = gBitmaps.HashMap;
-}
-
-EXPOSURE_RENDER_DLL void Render(int TracerID, Statistics& Statistics)
-{
-	cudaEvent_t EventStart, EventStop;
-
-	Cuda::HandleCudaError(cudaEventCreate(&EventStart));
-	Cuda::HandleCudaError(cudaEventCreate(&EventStop));
-	Cuda::HandleCudaError(cudaEventRecord(EventStart, 0));
-
-	Tracer& Tracer = gTracers[TracerID];
-
-	const float DensityScale		= Tracer.VolumeProperty.GetDensityScale();
-	const float StepFactorPrimary	= gVolumes[gVolumesHashMap[Tracer.VolumeIDs[0]]].MinStep * Tracer.VolumeProperty.GetStepFactorPrimary();
-	const float StepFactorShadow	= gVolumes[gVolumesHashMap[Tracer.VolumeIDs[0]]].MinStep * Tracer.VolumeProperty.GetStepFactorShadow();
-	
-	Cuda::HostToConstantDevice(&DensityScale, "gDensityScale");
-	Cuda::HostToConstantDevice(&StepFactorPrimary, "gStepFactorPrimary");
-	Cuda::HostToConstantDevice(&StepFactorShadow, "gStepFactorShadow");
-	
-	/*
-	if (Tracer.NoEstimates == 0)
-	{
-		if (Tracer.Camera.FocusMode == Enums::AutoFocus)
-		{
-			float AutoFocusDistance = -1.0f;
-
-			const Vec2i FilmUV((int)(Tracer.Camera.FocusUV[0] * (float)Tracer.FrameBuffer.Resolution[0]), (int)(Tracer.Camera.FocusUV[1] * (float)Tracer.FrameBuffer.Resolution[1]));
-			ComputeAutoFocusDistance(FilmUV, AutoFocusDistance, Statistics);
-
-			if (AutoFocusDistance >= 0.0f)
-				Tracer.Camera.FocalDistance = AutoFocusDistance;
-		}
-	}
-	*/
-
-	gTracers.Synchronize(TracerID);
-
-	if (Tracer.VolumeIDs[0] >= 0)
-		gVolumes[Tracer.VolumeIDs[0]].Voxels.Bind(TexVolume0);
-
-	if (Tracer.VolumeIDs[1] >= 0)
-		gVolumes[Tracer.VolumeIDs[1]].Voxels.Bind(TexVolume1);
-
-	Render(Tracer, Statistics);
-		
-	if (Tracer.NoiseReduction)
-		BilateralFilterRunningEstimate(Tracer, Statistics);
-	
-	Tracer.NoEstimates++;
-
-	Cuda::HandleCudaError(cudaEventRecord(EventStop, 0));
-	Cuda::HandleCudaError(cudaEventSynchronize(EventStop));
-																							
-	float TimeDelta = 0.0f;
-																							
-	Cuda::HandleCudaError(cudaEventElapsedTime(&TimeDelta, EventStart, EventStop), "cudaEventElapsedTime");
-	
-	Statistics.SetStatistic("FPS", "%.1f", "frames/sec", 1000.0f / TimeDelta);
-														
-	Cuda::HandleCudaError(cudaEventDestroy(EventStart));
-	Cuda::HandleCudaError(cudaEventDestroy(EventStop));										
-
-}
-
-EXPOSURE_RENDER_DLL void GetDisplayEstimate(int TracerID, ColorRGBAuc* pData)
-{
-	FrameBuffer& FB = gTracers[TracerID].FrameBuffer;
-
-	Cuda::MemCopyDeviceToHost(FB.DisplayEstimate.GetData(), (ColorRGBAuc*)pData, FB.DisplayEstimate.GetNoElements());
-}
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <map>
+#include <chrono>
+#include <vector>
+
+using namespace std;
+
+#ifdef ER_CPU
+	#include "cpu.h"
+
+	thread_local dim3 blockIdx;
+	thread_local dim3 threadIdx;
+	thread_local dim3 blockDim;
+	thread_local dim3 gridDim;
+#else
+	texture<unsigned short, 3, cudaReadModeNormalizedFloat> TexVolume0;
+	texture<unsigned short, 3, cudaReadModeNormalizedFloat> TexVolume1;
+#endif
+
+#include "color.h"
+
+map<int, int> gTracersHashMap;
+map<int, int> gVolumesHashMap;
+map<int, int> gObjectsHashMap;
+map<int, int> gClippingObjectsHashMap;
+map<int, int> gTexturesHashMap;
+map<int, int> gBitmapsHashMap;
+
+CONSTANT_DEVICE float gDensityScale			= 0.0f;
+CONSTANT_DEVICE float gStepFactorPrimary	= 0.0f;
+CONSTANT_DEVICE float gStepFactorShadow		= 0.0f;
+
+#include "statistics.h"
+#include "tracer.h"
+#include "volume.h"
+#include "object.h"
+#include "texture.h"
+#include "bitmap.h"
+
+DEVICE ExposureRender::Tracer*			gpTracer			= NULL;
+DEVICE ExposureRender::Volume* 			gpVolumes			= NULL;
+DEVICE ExposureRender::Object*			gpObjects			= NULL;
+DEVICE ExposureRender::Texture*			gpTextures			= NULL;
+DEVICE ExposureRender::Bitmap*			gpBitmaps			= NULL;
+
+#include "list.cuh"
+
+ExposureRender::Cuda::List<ExposureRender::Tracer, ExposureRender::HostTracer>					gTracers("gpTracer");
+ExposureRender::Cuda::List<ExposureRender::Volume, ExposureRender::HostVolume>					gVolumes("gpVolumes");
+ExposureRender::Cuda::List<ExposureRender::Object, ExposureRender::HostObject>					gObjects("gpObjects");
+ExposureRender::Cuda::List<ExposureRender::Texture, ExposureRender::HostTexture>				gTextures("gpTextures");
+ExposureRender::Cuda::List<ExposureRender::Bitmap, ExposureRender::HostBitmap>					gBitmaps("gpBitmaps");
+
+#ifdef ER_CPU
+/*! Registers the device symbols with the host emulation of the device memory interface */
+static struct DeviceSymbols
+{
+	DeviceSymbols()
+	{
+		ExposureRender::Cuda::RegisterSymbol("gDensityScale", &gDensityScale, sizeof(gDensityScale));
+		ExposureRender::Cuda::RegisterSymbol("gStepFactorPrimary", &gStepFactorPrimary, sizeof(gStepFactorPrimary));
+		ExposureRender::Cuda::RegisterSymbol("gStepFactorShadow", &gStepFactorShadow, sizeof(gStepFactorShadow));
+		ExposureRender::Cuda::RegisterSymbol("gpTracer", &gpTracer, sizeof(gpTracer));
+		ExposureRender::Cuda::RegisterSymbol("gpVolumes", &gpVolumes, sizeof(gpVolumes));
+		ExposureRender::Cuda::RegisterSymbol("gpObjects", &gpObjects, sizeof(gpObjects));
+		ExposureRender::Cuda::RegisterSymbol("gpTextures", &gpTextures, sizeof(gpTextures));
+		ExposureRender::Cuda::RegisterSymbol("gpBitmaps", &gpBitmaps, sizeof(gpBitmaps));
+	}
+} gDeviceSymbols;
+#endif
+
+#include "autofocus.cuh"
+#include "render.cuh"
+
+namespace ExposureRender
+{
+
+EXPOSURE_RENDER_DLL void BindTracer(const HostTracer& Tracer, const bool& Bind /*= true*/)
+{
+	if (Bind)
+		gTracers.Bind(Tracer);
+	else
+		gTracers.Unbind(Tracer);
+
+	gTracersHashMap = gTracers.HashMap;
+}
+
+EXPOSURE_RENDER_DLL void BindVolume(const HostVolume& Volume, const bool& Bind /*= true*/)
+{
+	if (Bind)
+		gVolumes.Bind(Volume);
+	else
+		gVolumes.Unbind(Volume);
+
+	gVolumesHashMap = gVolumes.HashMap;
+}
+
+EXPOSURE_RENDER_DLL void BindObject(const HostObject& Object, const bool& Bind /*= true*/)
+{
+	if (Bind)
+		gObjects.Bind(Object);
+	else
+		gObjects.Unbind(Object);
+
+	gObjectsHashMap = gObjects.HashMap;
+}
+
+EXPOSURE_RENDER_DLL void BindTexture(const HostTexture& Texture, const bool& Bind /*= true*/)
+{
+	if (Bind)
+		gTextures.Bind(Texture);
+	else
+		gTextures.Unbind(Texture);
+
+	gTexturesHashMap = gTextures.HashMap;
+}
+
+EXPOSURE_RENDER_DLL void BindBitmap(const HostBitmap& Bitmap, const bool& Bind /*= true*/)
+{
+	if (Bind)
+		gBitmaps.Bind(Bitmap);
+	else
+		gBitmaps.Unbind(Bitmap);
+
+	gBitmapsHashMap = gBitmaps.HashMap;
+}
+
+/*! Prepares tracer \a TracerID and its volumes for rendering estimates, this streams bricks, classifies and quantizes the volumes, builds the pre-integration table and binds the textures
+	@param[in] TracerID Tracer ID
+	@return Tracer
+*/
+Tracer& PrepareRender(const int& TracerID)
+{
+	Tracer& Tracer = gTracers[TracerID];
+
+	const float DensityScale		= Tracer.VolumeProperty.GetDensityScale();
+	const float StepFactorPrimary	= gVolumes[gVolumesHashMap[Tracer.VolumeIDs[0]]].MinStep * Tracer.VolumeProperty.GetStepFactorPrimary();
+	const float StepFactorShadow	= gVolumes[gVolumesHashMap[Tracer.VolumeIDs[0]]].MinStep * Tracer.VolumeProperty.GetStepFactorShadow();
+	
+	Cuda::HostToConstantDevice(&DensityScale, "gDensityScale");
+	Cuda::HostToConstantDevice(&StepFactorPrimary, "gStepFactorPrimary");
+	Cuda::HostToConstantDevice(&StepFactorShadow, "gStepFactorShadow");
+	
+	/*
+	if (Tracer.NoEstimates == 0)
+	{
+		if (Tracer.Camera.FocusMode == Enums::AutoFocus)
+		{
+			float AutoFocusDistance = -1.0f;
+
+			const Vec2i FilmUV((int)(Tracer.Camera.FocusUV[0] * (float)Tracer.FrameBuffer.Resolution[0]), (int)(Tracer.Camera.FocusUV[1] * (float)Tracer.FrameBuffer.Resolution[1]));
+			ComputeAutoFocusDistance(FilmUV, AutoFocusDistance, Statistics);
+
+			if (AutoFocusDistance >= 0.0f)
+				Tracer.Camera.FocalDistance = AutoFocusDistance;
+		}
+	}
+	*/
+
+	// IDs of the volumes the tracer renders, the tracer stores their device indices
+	vector<int> VolumeIDs;
+
+	for (int i = 0; i < Tracer.VolumeIDs.GetNoIndices(); i++)
+	{
+		for (map<int, int>::iterator It = gVolumesHashMap.begin(); It != gVolumesHashMap.end(); It++)
+		{
+			if (It->second == Tracer.VolumeIDs[i])
+				VolumeIDs.push_back(It->first);
+		}
+	}
+
+#ifdef ER_CPU
+	// The transfer function nodes are given in the native units of the voxels, map them to the intensity domain of the first volume
+	if (!VolumeIDs.empty())
+	{
+		const Volume& Volume = gVolumes[VolumeIDs[0]];
+
+		const Vec2f NodeMapping = GetIntensityMapping(Volume.VoxelType, Volume.NativeMin, Volume.NativeScale);
+
+		if (NodeMapping != Tracer.NodeMapping)
+		{
+			const float Scale = NodeMapping[0] / Tracer.NodeMapping[0];
+
+			Tracer.VolumeProperty.MapNodePositions(Scale, NodeMapping[1] - Tracer.NodeMapping[1] * Scale);
+
+			Tracer.NodeMapping	= NodeMapping;
+			Tracer.NoEstimates	= 0;
+		}
+	}
+#endif
+
+#ifdef ER_CPU
+	// Stream in the bricks the previous frame missed, its samples fell back to the coarse voxels so the estimate restarts
+	for (size_t i = 0; i < VolumeIDs.size(); i++)
+	{
+		if (gVolumes[VolumeIDs[i]].Bricks.Update())
+			Tracer.NoEstimates = 0;
+	}
+#endif
+
+	// Classify the empty space accelerators and the classified opacities when the opacity function changed
+	bool Classified = false;
+
+	for (size_t i = 0; i < VolumeIDs.size(); i++)
+		Classified |= gVolumes[VolumeIDs[i]].Classify(Tracer.VolumeProperty);
+
+#ifdef ER_CPU
+	// The marchers sample the classified opacities when every volume has them
+	Tracer.ClassifiedSampling = Tracer.VolumeProperty.GetOpacityClassification() != Enums::PostClassification;
+
+	for (size_t i = 0; i < VolumeIDs.size(); i++)
+		Tracer.ClassifiedSampling &= gVolumes[VolumeIDs[i]].Classified.GetEnabled();
+
+	// The device copies of the volumes still point to the previous classified opacities
+	if (Classified)
+		gVolumes.Synchronize();
+#endif
+
+#ifdef ER_CPU
+	// The first estimates after a restart sample the quantized voxels when the opacity error they cause is tolerable, the quantized voxels follow the window of the transfer functions
+	Tracer.QuantizedSampling = Tracer.NoEstimates < Tracer.VolumeProperty.GetNoQuantizedEstimates();
+
+	if (Tracer.QuantizedSampling)
+	{
+		bool Quantized = false;
+
+		for (size_t i = 0; i < VolumeIDs.size(); i++)
+		{
+			Volume& Volume = gVolumes[VolumeIDs[i]];
+
+			Quantized |= Volume.Quantize(Tracer.VolumeProperty);
+
+			if (!Volume.Quantized.GetEnabled() || Volume.Quantized.GetMaxOpacityError(Tracer.VolumeProperty.GetOpacity1D()) > Tracer.VolumeProperty.GetQuantizationTolerance())
+				Tracer.QuantizedSampling = false;
+		}
+
+		// The device copies of the volumes still point to the previous quantized voxels
+		if (Quantized)
+			gVolumes.Synchronize();
+	}
+#endif
+
+	// A restart samples every tile again
+	if (Tracer.NoEstimates == 0)
+	{
+		Tracer.FrameBuffer.TileNoEstimates.Reset();
+		Tracer.FrameBuffer.TileConverged.Reset();
+
+		Tracer.NoConvergedTiles = 0;
+	}
+
+	// Rebuild the pre-integration table when the transfer functions or the step size may have changed
+	if (Tracer.RenderMode == Enums::StandardRayCasting && (Tracer.NoEstimates == 0 || Tracer.PreIntegrationTable.GetStepSize() != StepFactorPrimary))
+		Tracer.PreIntegrationTable.Build(Tracer.VolumeProperty.GetOpacity1D(), Tracer.VolumeProperty.GetDiffuse1D(), StepFactorPrimary);
+
+#ifndef ER_CPU
+	if (Tracer.VolumeIDs[0] >= 0)
+		gVolumes[Tracer.VolumeIDs[0]].Voxels.Bind(TexVolume0);
+
+	if (Tracer.VolumeIDs[1] >= 0)
+		gVolumes[Tracer.VolumeIDs[1]].Voxels.Bind(TexVolume1);
+#endif
+
+	return Tracer;
+}
+
+/*! Renders the next estimate of tracer \a TracerID, which has to be prepared with PrepareRender
+	@param[in] TracerID Tracer ID
+	@param[in] Statistics Statistics
+*/
+void RenderNextEstimate(const int& TracerID, Statistics& Statistics)
+{
+	Tracer& Tracer = gTracers[TracerID];
+
+	// Once enough estimates sampled the quantized voxels, the next ones sample the full precision voxels
+	if (Tracer.NoEstimates >= Tracer.VolumeProperty.GetNoQuantizedEstimates())
+		Tracer.QuantizedSampling = false;
+
+	// The device copy of the tracer needs the number of estimates for the tile sampling
+	gTracers.Synchronize(TracerID);
+
+	RenderEstimate(Tracer, Statistics);
+
+	Tracer.NoEstimates++;
+}
+
+/*! Reduces the noise of the running estimate of tracer \a TracerID and updates its display estimate
+	@param[in] TracerID Tracer ID
+	@param[in] Statistics Statistics
+*/
+void FinishRender(const int& TracerID, Statistics& Statistics)
+{
+	Tracer& Tracer = gTracers[TracerID];
+
+	RenderDisplayEstimate(Tracer, Statistics);
+
+	if (Tracer.NoiseReduction)
+		BilateralFilterRunningEstimate(Tracer, Statistics);
+}
+
+EXPOSURE_RENDER_DLL void Render(int TracerID, Statistics& Statistics)
+{
+#ifdef ER_CPU
+	Cpu::Timer Timer;
+#else
+	cudaEvent_t EventStart, EventStop;
+
+	Cuda::HandleCudaError(cudaEventCreate(&EventStart));
+	Cuda::HandleCudaError(cudaEventCreate(&EventStop));
+	Cuda::HandleCudaError(cudaEventRecord(EventStart, 0));
+#endif
+
+	PrepareRender(TracerID);
+	RenderNextEstimate(TracerID, Statistics);
+	FinishRender(TracerID, Statistics);
+
+#ifdef ER_CPU
+	Statistics.SetStatistic("FPS", "%.1f", "frames/sec", 1000.0f / max(Timer.ElapsedTime(), 0.001f));
+#else
+	Cuda::HandleCudaError(cudaEventRecord(EventStop, 0));
+	Cuda::HandleCudaError(cudaEventSynchronize(EventStop));
+																							
+	float TimeDelta = 0.0f;
+																							
+	Cuda::HandleCudaError(cudaEventElapsedTime(&TimeDelta, EventStart, EventStop), "cudaEventElapsedTime");
+	
+	Statistics.SetStatistic("FPS", "%.1f", "frames/sec", 1000.0f / TimeDelta);
+														
+	Cuda::HandleCudaError(cudaEventDestroy(EventStart));
+	Cuda::HandleCudaError(cudaEventDestroy(EventStop));										
+#endif
+
+}
+
+EXPOSURE_RENDER_DLL int Render(int TracerID, Statistics& Statistics, float Budget, bool& Converged)
+{
+	const std::chrono::high_resolution_clock::time_point Start = std::chrono::high_resolution_clock::now();
+
+	// The setup is done once, the loop only renders estimates
+	Tracer& Tracer = PrepareRender(TracerID);
+
+	int NoEstimates = 0;
+
+	float Elapsed = 0.0f;
+
+	while (true)
+	{
+		RenderNextEstimate(TracerID, Statistics);
+
+		NoEstimates++;
+
+		Elapsed = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+		// Ray casting renders a single estimate, the stochastic estimate converged when all of its tiles did
+		if (Tracer.RenderMode == Enums::StandardRayCasting)
+			Converged = true;
+		else
+			Converged = Tracer.NoConvergedTiles >= Tracer.FrameBuffer.TileConverged.GetNoElements();
+
+		// Stop when the next estimate, which is assumed to take as long as the average one so far, would exceed the budget
+		if (Converged || Elapsed + Elapsed / (float)NoEstimates > Budget)
+			break;
+	}
+
+	FinishRender(TracerID, Statistics);
+
+	Statistics.SetStatistic("Estimates per call", "%.0f", "estimates", (float)NoEstimates);
+
+	return NoEstimates;
+}
+
+EXPOSURE_RENDER_DLL void GetDisplayEstimate(int TracerID, ColorRGBAuc* pData)
+{
+	FrameBuffer& FB = gTracers[TracerID].FrameBuffer;
+
+	Cuda::MemCopyDeviceToHost(FB.DisplayEstimate.GetData(), (ColorRGBAuc*)pData, FB.DisplayEstimate.GetNoElements());
+}
+
+}
@@ -0,0 +1,110 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#ifdef ER_CPU
+
+#include "threadpool.h"
+
+#include <chrono>
+
+/*! Grid and block dimensions, mirrors the CUDA type */
+struct dim3
+{
+	HOST dim3(unsigned int X = 1, unsigned int Y = 1, unsigned int Z = 1) :
+		x(X),
+		y(Y),
+		z(Z)
+	{
+	}
+
+	unsigned int x, y, z;
+};
+
+/*! Per thread launch indices, emulate the CUDA built-in variables (defined in core.cu) */
+extern thread_local dim3 blockIdx;
+extern thread_local dim3 threadIdx;
+extern thread_local dim3 blockDim;
+extern thread_local dim3 gridDim;
+
+namespace ExposureRender
+{
+
+namespace Cpu
+{
+
+/*! Executes a kernel for each thread in the grid, each block is a task for the thread pool
+	@param[in] GridDim Grid dimensions
+	@param[in] BlockDim Block dimensions
+	@param[in] Kernel Kernel invocation
+*/
+template<class KernelType> static inline void Launch(const dim3& GridDim, const dim3& BlockDim, const KernelType& Kernel)
+{
+	const int NoBlocks = GridDim.x * GridDim.y * GridDim.z;
+
+	ThreadPool::Get().Run(NoBlocks, [&](int BlockID)
+	{
+		const dim3 PreviousBlockIdx = blockIdx, PreviousThreadIdx = threadIdx, PreviousBlockDim = blockDim, PreviousGridDim = gridDim;
+
+		gridDim		= GridDim;
+		blockDim	= BlockDim;
+
+		blockIdx.x	= BlockID % GridDim.x;
+		blockIdx.y	= (BlockID / GridDim.x) % GridDim.y;
+		blockIdx.z	= BlockID / (GridDim.x * GridDim.y);
+
+		for (threadIdx.z = 0; threadIdx.z < BlockDim.z; threadIdx.z++)
+			for (threadIdx.y = 0; threadIdx.y < BlockDim.y; threadIdx.y++)
+				for (threadIdx.x = 0; threadIdx.x < BlockDim.x; threadIdx.x++)
+					Kernel();
+
+		blockIdx	= PreviousBlockIdx;
+		threadIdx	= PreviousThreadIdx;
+		blockDim	= PreviousBlockDim;
+		gridDim		= PreviousGridDim;
+	});
+}
+
+/*! \class Timer
+ * \brief Wall clock timer used to time CPU kernels
+ */
+class Timer
+{
+public:
+	/*! Constructor, starts the timer */
+	HOST Timer() :
+		Start(std::chrono::high_resolution_clock::now())
+	{
+	}
+
+	/*! Gets the elapsed time
+		@return Elapsed time in milliseconds
+	*/
+	HOST float ElapsedTime() const
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - this->Start).count();
+	}
+
+protected:
+	std::chrono::high_resolution_clock::time_point	Start;		/*! Start time */
+};
+
+}
+
+}
+
+#endif
@@ -1,41 +1,109 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "geometry.h"
-#include "utilities.h"
-
-namespace ExposureRender
-{
-
-KERNEL void KrnlComputeEstimate()
-{
-	KERNEL_2D(gpTracer->FrameBuffer.Resolution[0], gpTracer->FrameBuffer.Resolution[1])
-
-	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[0] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[0], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[0], gpTracer->NoEstimates + 1);
-	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[1] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[1], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[1], gpTracer->NoEstimates + 1);
-	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[2] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[2], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[2], gpTracer->NoEstimates + 1);
-	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[3] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[3], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[3], gpTracer->NoEstimates + 1);
-}
-
-void ComputeEstimate(Tracer& Tracer, Statistics& Statistics)
-{
-	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.Resolution[0], Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
-	LAUNCH_CUDA_KERNEL_TIMED((KrnlComputeEstimate<<<GridDim, BlockDim>>>()), "Compute estimate");
-}
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "geometry.h"
+#include "utilities.h"
+
+namespace ExposureRender
+{
+
+/*! Accumulates the running mean and variance (Welford) of the luminance of every sampled pixel from its unfiltered frame estimate, the variance of the filtered estimates would understate the noise */
+KERNEL void KrnlComputeVariance()
+{
+	KERNEL_2D(gpTracer->FrameBuffer.Resolution[0], gpTracer->FrameBuffer.Resolution[1])
+
+	if (!gpTracer->FrameBuffer.GetSampled(IDx, IDy, gpTracer->NoEstimates))
+		return;
+
+	const int N = gpTracer->FrameBuffer.GetNoEstimates(IDx, IDy) + 1;
+
+	const float Y		= gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[1];
+	const float Mean	= gpTracer->FrameBuffer.RunningLuminance(IDx, IDy);
+
+	gpTracer->FrameBuffer.RunningLuminance(IDx, IDy) = CumulativeMovingAverage(Mean, Y, N);
+
+	gpTracer->FrameBuffer.RunningVariance(IDx, IDy) = N > 1 ? gpTracer->FrameBuffer.RunningVariance(IDx, IDy) + (Y - Mean) * (Y - gpTracer->FrameBuffer.RunningLuminance(IDx, IDy)) : 0.0f;
+}
+
+KERNEL void KrnlComputeEstimate()
+{
+	KERNEL_2D(gpTracer->FrameBuffer.Resolution[0], gpTracer->FrameBuffer.Resolution[1])
+
+	// Tiles which are not sampled keep their estimate
+	if (!gpTracer->FrameBuffer.GetSampled(IDx, IDy, gpTracer->NoEstimates))
+		return;
+
+	const int N = gpTracer->FrameBuffer.GetNoEstimates(IDx, IDy) + 1;
+
+	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[0] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[0], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[0], N);
+	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[1] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[1], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[1], N);
+	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[2] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[2], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[2], N);
+	gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[3] = CumulativeMovingAverage(gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy)[3], gpTracer->FrameBuffer.FrameEstimate(IDx, IDy)[3], N);
+}
+
+/*! Updates the number of estimates of every tile sampled by this estimate and decides whether the tile converged, which is when the relative standard error of the mean luminance of all its pixels is below the convergence threshold of the tracer */
+KERNEL void KrnlComputeConvergence()
+{
+	KERNEL_2D(gpTracer->FrameBuffer.TileResolution[0], gpTracer->FrameBuffer.TileResolution[1])
+
+	if (!gpTracer->FrameBuffer.GetSampled(IDx * CONVERGENCE_TILE_SIZE, IDy * CONVERGENCE_TILE_SIZE, gpTracer->NoEstimates))
+		return;
+
+	const int N = ++gpTracer->FrameBuffer.TileNoEstimates(IDx, IDy);
+
+	if (gpTracer->ConvergenceThreshold <= 0.0f || N < CONVERGENCE_MIN_ESTIMATES)
+		return;
+
+	const int MinX = IDx * CONVERGENCE_TILE_SIZE;
+	const int MinY = IDy * CONVERGENCE_TILE_SIZE;
+	const int MaxX = min(MinX + CONVERGENCE_TILE_SIZE, gpTracer->FrameBuffer.Resolution[0]);
+	const int MaxY = min(MinY + CONVERGENCE_TILE_SIZE, gpTracer->FrameBuffer.Resolution[1]);
+
+	for (int y = MinY; y < MaxY; y++)
+	{
+		for (int x = MinX; x < MaxX; x++)
+		{
+			const float StandardError = sqrtf(gpTracer->FrameBuffer.RunningVariance(x, y) / (float)(N * (N - 1)));
+
+			if (StandardError > gpTracer->ConvergenceThreshold * gpTracer->FrameBuffer.RunningLuminance(x, y))
+				return;
+		}
+	}
+
+	gpTracer->FrameBuffer.TileConverged(IDx, IDy) = 1;
+}
+
+void ComputeVariance(Tracer& Tracer, Statistics& Statistics)
+{
+	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.Resolution[0], Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
+	LAUNCH_KERNEL_TIMED(KrnlComputeVariance, (), "Compute variance");
+}
+
+void ComputeEstimate(Tracer& Tracer, Statistics& Statistics)
+{
+	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.Resolution[0], Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
+	LAUNCH_KERNEL_TIMED(KrnlComputeEstimate, (), "Compute estimate");
+}
+
+void ComputeConvergence(Tracer& Tracer, Statistics& Statistics)
+{
+	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.TileResolution[0], Tracer.FrameBuffer.TileResolution[1], 1, BLOCK_W, BLOCK_H, 1)
+	LAUNCH_KERNEL_TIMED(KrnlComputeConvergence, (), "Compute convergence");
+}
+
+}
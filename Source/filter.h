@@ -1,65 +1,65 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "vector.h"
-
-namespace ExposureRender
-{
-
-/*! Base filter class */
-class Filter
-{
-public:
-	/*! Constructor
-		@param Size Size of the filter
-	*/
-	HOST_DEVICE Filter(const Vec2f& Size) :
-		Size(Size),
-		InvSize(1.0f / Size[0], 1.0f / Size[1])
-	{
-	}
-	
-	/*! Copy constructor
-		@param[in] Other Filter to copy
-	*/
-	HOST Filter(const Filter& Other)
-	{
-		*this = Other;
-	}
-	
-	/*! Assignment operator
-		@param[in] Other Filter to copy
-		@return Copied filter
-	*/
-	HOST Filter& operator = (const Filter& Other)
-	{
-		this->Size		= Other.Size;
-		this->InvSize	= Other.InvSize;
-
-		return *this;
-	}
-
-	GET_MACRO(HOST_DEVICE, Size, Vec2f)
-	GET_MACRO(HOST_DEVICE, InvSize, Vec2f)
-
-protected:
-	Vec2f Size;			/*! Size of the filter */
-	Vec2f InvSize;		/*! Inverse size of the filter */
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vector.h"
+
+namespace ExposureRender
+{
+
+/*! Base filter class */
+class Filter
+{
+public:
+	/*! Constructor
+		@param Size Size of the filter
+	*/
+	HOST_DEVICE Filter(const Vec2f& Size) :
+		Size(Size),
+		InvSize(1.0f / Size[0], 1.0f / Size[1])
+	{
+	}
+	
+	/*! Copy constructor
+		@param[in] Other Filter to copy
+	*/
+	HOST Filter(const Filter& Other)
+	{
+		*this = Other;
+	}
+	
+	/*! Assignment operator
+		@param[in] Other Filter to copy
+		@return Copied filter
+	*/
+	HOST Filter& operator = (const Filter& Other)
+	{
+		this->Size		= Other.Size;
+		this->InvSize	= Other.InvSize;
+
+		return *this;
+	}
+
+	GET_MACRO(HOST_DEVICE, Size, Vec2f)
+	GET_MACRO(HOST_DEVICE, InvSize, Vec2f)
+
+protected:
+	Vec2f Size;			/*! Size of the filter */
+	Vec2f InvSize;		/*! Inverse size of the filter */
+};
+
+}
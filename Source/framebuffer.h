@@ -1,94 +1,190 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "buffers.h"
-#include "randomseedbuffers.h"
-#include "rendersample.h"
-
-namespace ExposureRender
-{
-
-/*! Frame buffer class */
-class FrameBuffer
-{
-public:
-	HOST FrameBuffer(void) :
-		Resolution(),
-		FrameEstimate("Frame Estimate", Enums::Device),
-		TempFrameEstimate("Temp Frame Estimate", Enums::Device),
-		RunningEstimateXYZ("Running estimate XYZ", Enums::Device),
-		RunningEstimateRGB("Running estimate RGB", Enums::Device),
-		TempRunningEstimateRGB("Temp running estimate RGB", Enums::Device),
-		DisplayEstimate("Display Estimate", Enums::Device),
-		DVR("DVR", Enums::Device),
-		RandomSeeds1("Random Seeds 1", Enums::Device),
-		RandomSeeds2("Random Seeds 2", Enums::Device),
-		RandomSeedsCopy1("Random Seeds 1 Copy", Enums::Device),
-		RandomSeedsCopy2("Random Seeds 2 Copy", Enums::Device),
-		HostDisplayEstimate("Display Estimate", Enums::Host),
-		IDs("IDs", Enums::Device),
-		Samples("Samples", Enums::Device),
-		PixelHysteresis("Pixel hysteresis", Enums::Device)
-	{
-	}
-
-	HOST void Resize(const Vec2i& Resolution)
-	{
-		if (this->Resolution == Resolution)
-			return;
-		
-		this->Resolution = Resolution;
-
-		this->FrameEstimate.Resize(this->Resolution);
-		this->TempFrameEstimate.Resize(this->Resolution);
-		this->RunningEstimateXYZ.Resize(this->Resolution);
-		this->RunningEstimateRGB.Resize(this->Resolution);
-		this->TempRunningEstimateRGB.Resize(this->Resolution);
-		this->TempRunningEstimateRGB.Resize(this->Resolution);
-		this->DisplayEstimate.Resize(this->Resolution);
-		this->DVR.Resize(this->Resolution);
-		this->RandomSeeds1.Resize(this->Resolution);
-		this->RandomSeeds2.Resize(this->Resolution);
-		this->HostDisplayEstimate.Resize(this->Resolution);
-		this->IDs.Resize(this->Resolution);
-		this->Samples.Resize(this->Resolution);
-		this->PixelHysteresis.Resize(this->Resolution);
-		
-		this->RandomSeedsCopy1 = this->RandomSeeds1;
-		this->RandomSeedsCopy2 = this->RandomSeeds2;
-	}
-
-	Vec2i						Resolution;
-	Buffer2D<ColorXYZAf>		FrameEstimate;
-	Buffer2D<ColorXYZAf>		TempFrameEstimate;
-	Buffer2D<ColorXYZAf>		RunningEstimateXYZ;
-	Buffer2D<ColorRGBAuc>		RunningEstimateRGB;
-	Buffer2D<ColorRGBAuc>		TempRunningEstimateRGB;
-	Buffer2D<ColorRGBAuc>		DisplayEstimate;
-	Buffer2D<ColorRGBAuc>		DVR;
-	RandomSeedBuffer2D			RandomSeeds1;
-	RandomSeedBuffer2D			RandomSeeds2;
-	RandomSeedBuffer2D			RandomSeedsCopy1;
-	RandomSeedBuffer2D			RandomSeedsCopy2;
-	Buffer2D<ColorRGBAuc>		HostDisplayEstimate;
-	Buffer2D<int>				IDs;
-	Buffer2D<RenderSample>		Samples;
-	Buffer2D<PixelHysteresis>	PixelHysteresis;
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "buffers.h"
+#include "randomseedbuffers.h"
+#include "rendersample.h"
+#include "regionofinterest.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace ExposureRender
+{
+
+#define CONVERGENCE_TILE_SIZE			16
+#define CONVERGENCE_MIN_ESTIMATES		16
+
+/*! Frame buffer class */
+class FrameBuffer
+{
+public:
+	HOST FrameBuffer(void) :
+		Resolution(),
+		FrameEstimate("Frame Estimate", Enums::Device),
+		TempFrameEstimate("Temp Frame Estimate", Enums::Device),
+		RunningEstimateXYZ("Running estimate XYZ", Enums::Device),
+		RunningEstimateRGB("Running estimate RGB", Enums::Device),
+		TempRunningEstimateRGB("Temp running estimate RGB", Enums::Device),
+		DisplayEstimate("Display Estimate", Enums::Device),
+		DVR("DVR", Enums::Device),
+		RandomSeeds1("Random Seeds 1", Enums::Device),
+		RandomSeeds2("Random Seeds 2", Enums::Device),
+		RandomSeedsCopy1("Random Seeds 1 Copy", Enums::Device),
+		RandomSeedsCopy2("Random Seeds 2 Copy", Enums::Device),
+		HostDisplayEstimate("Display Estimate", Enums::Host),
+		IDs("IDs", Enums::Device),
+		Queue("Queue", Enums::Device),
+		Samples("Samples", Enums::Device),
+		PixelHysteresis("Pixel hysteresis", Enums::Device),
+		RunningLuminance("Running luminance", Enums::Device),
+		RunningVariance("Running variance", Enums::Device),
+		TileResolution(),
+		TileNoEstimates("Tile estimates", Enums::Device),
+		TileConverged("Tile converged", Enums::Device),
+		TileWeight("Tile weight", Enums::Device)
+	{
+	}
+
+	HOST void Resize(const Vec2i& Resolution)
+	{
+		if (this->Resolution == Resolution)
+			return;
+		
+		this->Resolution = Resolution;
+
+		this->FrameEstimate.Resize(this->Resolution);
+		this->TempFrameEstimate.Resize(this->Resolution);
+		this->RunningEstimateXYZ.Resize(this->Resolution);
+		this->RunningEstimateRGB.Resize(this->Resolution);
+		this->TempRunningEstimateRGB.Resize(this->Resolution);
+		this->TempRunningEstimateRGB.Resize(this->Resolution);
+		this->DisplayEstimate.Resize(this->Resolution);
+		this->DVR.Resize(this->Resolution);
+		this->RandomSeeds1.Resize(this->Resolution);
+		this->RandomSeeds2.Resize(this->Resolution);
+		this->HostDisplayEstimate.Resize(this->Resolution);
+		this->IDs.Resize(this->Resolution);
+		this->Queue.Resize(Vec<int, 1>(this->Resolution.CumulativeProduct()));
+		this->Samples.Resize(this->Resolution);
+		this->PixelHysteresis.Resize(this->Resolution);
+		this->RunningLuminance.Resize(this->Resolution);
+		this->RunningVariance.Resize(this->Resolution);
+
+		for (int i = 0; i < 2; i++)
+			this->TileResolution[i] = (this->Resolution[i] + CONVERGENCE_TILE_SIZE - 1) / CONVERGENCE_TILE_SIZE;
+
+		this->TileNoEstimates.Resize(this->TileResolution);
+		this->TileConverged.Resize(this->TileResolution);
+		this->TileWeight.Resize(this->TileResolution);
+		
+		this->RandomSeedsCopy1 = this->RandomSeeds1;
+		this->RandomSeedsCopy2 = this->RandomSeeds2;
+	}
+
+	/*! Sets the sampling weight of every tile from the weight of \a RegionsOfInterest at the center of the tile. The weights are divided by the largest weight when it exceeds one, so tiles with the largest weight are sampled by every estimate and a weight of one by a fraction of them, the other estimates only sample the regions of interest and are cheaper, which lets the budgeted render fit more of them
+		@param[in] RegionsOfInterest Regions of interest
+		@param[in] PeripheralWeight Sampling weight outside the regions of interest
+	*/
+	HOST void SetTileWeights(const RegionsOfInterest& RegionsOfInterest, const float& PeripheralWeight)
+	{
+		if (this->TileResolution.CumulativeProduct() <= 0)
+			return;
+
+		std::vector<float> Weights(this->TileResolution.CumulativeProduct());
+
+		for (int Y = 0; Y < this->TileResolution[1]; Y++)
+		{
+			for (int X = 0; X < this->TileResolution[0]; X++)
+			{
+				const Vec2f UV(min((X + 0.5f) * CONVERGENCE_TILE_SIZE, (float)this->Resolution[0]) / (float)this->Resolution[0], min((Y + 0.5f) * CONVERGENCE_TILE_SIZE, (float)this->Resolution[1]) / (float)this->Resolution[1]);
+
+				Weights[Y * this->TileResolution[0] + X] = RegionsOfInterest.GetWeight(UV, PeripheralWeight);
+			}
+		}
+
+		const float MaxWeight = max(*std::max_element(Weights.begin(), Weights.end()), 1.0f);
+
+		for (size_t i = 0; i < Weights.size(); i++)
+			Weights[i] /= MaxWeight;
+
+		this->TileWeight.Set(Enums::Host, this->TileResolution, &Weights[0]);
+	}
+
+	/*! Gets whether the tile which contains pixel (\a X, \a Y) is sampled by estimate \a NoEstimates, converged tiles are never sampled and a tile with weight w is sampled by a fraction w of the estimates, starting with the first
+		@param[in] X Pixel x coordinate
+		@param[in] Y Pixel y coordinate
+		@param[in] NoEstimates Number of estimates rendered so far
+		@return Whether the tile is sampled
+	*/
+	HOST_DEVICE bool GetSampled(const int& X, const int& Y, const int& NoEstimates) const
+	{
+		if (this->GetConverged(X, Y))
+			return false;
+
+		const float Weight = this->TileWeight(X / CONVERGENCE_TILE_SIZE, Y / CONVERGENCE_TILE_SIZE);
+
+		return Weight >= 1.0f || ceilf((float)(NoEstimates + 1) * Weight) > ceilf((float)NoEstimates * Weight);
+	}
+
+	/*! Gets whether pixel (\a X, \a Y) lies in a converged tile
+		@param[in] X Pixel x coordinate
+		@param[in] Y Pixel y coordinate
+		@return Whether the tile converged
+	*/
+	HOST_DEVICE bool GetConverged(const int& X, const int& Y) const
+	{
+		return this->TileConverged(X / CONVERGENCE_TILE_SIZE, Y / CONVERGENCE_TILE_SIZE) != 0;
+	}
+
+	/*! Gets the number of estimates of the tile which contains pixel (\a X, \a Y)
+		@param[in] X Pixel x coordinate
+		@param[in] Y Pixel y coordinate
+		@return Number of estimates
+	*/
+	HOST_DEVICE int GetNoEstimates(const int& X, const int& Y) const
+	{
+		return this->TileNoEstimates(X / CONVERGENCE_TILE_SIZE, Y / CONVERGENCE_TILE_SIZE);
+	}
+
+	Vec2i						Resolution;
+	Buffer2D<ColorXYZAf>		FrameEstimate;
+	Buffer2D<ColorXYZAf>		TempFrameEstimate;
+	Buffer2D<ColorXYZAf>		RunningEstimateXYZ;
+	Buffer2D<ColorRGBAuc>		RunningEstimateRGB;
+	Buffer2D<ColorRGBAuc>		TempRunningEstimateRGB;
+	Buffer2D<ColorRGBAuc>		DisplayEstimate;
+	Buffer2D<ColorRGBAuc>		DVR;
+	RandomSeedBuffer2D			RandomSeeds1;
+	RandomSeedBuffer2D			RandomSeeds2;
+	RandomSeedBuffer2D			RandomSeedsCopy1;
+	RandomSeedBuffer2D			RandomSeedsCopy2;
+	Buffer2D<ColorRGBAuc>		HostDisplayEstimate;
+	Buffer2D<int>				IDs;
+	Buffer1D<int>				Queue;
+	Buffer2D<RenderSample>		Samples;
+	Buffer2D<PixelHysteresis>	PixelHysteresis;
+	Buffer2D<float>				RunningLuminance;
+	Buffer2D<float>				RunningVariance;
+	Vec2i						TileResolution;
+	Buffer2D<int>				TileNoEstimates;
+	Buffer2D<unsigned char>		TileConverged;
+	Buffer2D<float>				TileWeight;
+};
+
+}
@@ -0,0 +1,230 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer3d.h"
+
+namespace ExposureRender
+{
+
+#define GRADIENT_NORMAL_BITS				11
+#define GRADIENT_MAGNITUDE_EXPONENT_BITS	4
+#define GRADIENT_MAGNITUDE_MANTISSA_BITS	6
+
+/*! Encodes unit vector \a N with an octahedral mapping into two unsigned integers of GRADIENT_NORMAL_BITS bits each
+	@param[in] N Unit vector
+	@return Packed octahedral coordinates
+*/
+HOST_DEVICE inline unsigned int EncodeOctahedral(const Vec3f& N)
+{
+	const float L1 = fabsf(N[0]) + fabsf(N[1]) + fabsf(N[2]);
+
+	const float InvL1 = L1 > 0.0f ? 1.0f / L1 : 0.0f;
+
+	float U = N[0] * InvL1;
+	float V = N[1] * InvL1;
+
+	// Fold the lower hemisphere over the diagonals
+	if (N[2] < 0.0f)
+	{
+		const float FoldedU = (1.0f - fabsf(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+		const float FoldedV = (1.0f - fabsf(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+
+		U = FoldedU;
+		V = FoldedV;
+	}
+
+	const float HalfMax = 0.5f * (float)((1 << GRADIENT_NORMAL_BITS) - 1);
+
+	// U and V lie in [-1, 1], so the quantized coordinates need no clamping
+	const unsigned int QU = (unsigned int)(U * HalfMax + HalfMax + 0.5f);
+	const unsigned int QV = (unsigned int)(V * HalfMax + HalfMax + 0.5f);
+
+	return (QV << GRADIENT_NORMAL_BITS) | QU;
+}
+
+/*! Decodes a unit vector packed with EncodeOctahedral
+	@param[in] Packed Packed octahedral coordinates
+	@return Unit vector
+*/
+HOST_DEVICE inline Vec3f DecodeOctahedral(const unsigned int& Packed)
+{
+	const unsigned int Mask = (1 << GRADIENT_NORMAL_BITS) - 1;
+
+	const float InvMax = 1.0f / (float)Mask;
+
+	const float U = (float)(Packed & Mask) * InvMax * 2.0f - 1.0f;
+	const float V = (float)((Packed >> GRADIENT_NORMAL_BITS) & Mask) * InvMax * 2.0f - 1.0f;
+
+	Vec3f N(U, V, 1.0f - fabsf(U) - fabsf(V));
+
+	if (N[2] < 0.0f)
+	{
+		N[0] = (1.0f - fabsf(V)) * (U >= 0.0f ? 1.0f : -1.0f);
+		N[1] = (1.0f - fabsf(U)) * (V >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	return Normalize(N);
+}
+
+/*! Encodes gradient magnitude \a Magnitude as a small float with a GRADIENT_MAGNITUDE_EXPONENT_BITS bit exponent and a GRADIENT_MAGNITUDE_MANTISSA_BITS bit mantissa, which covers the range of 16 bit central differences with a relative error below one percent and needs no global scale
+	@param[in] Magnitude Gradient magnitude
+	@return Encoded gradient magnitude
+*/
+HOST_DEVICE inline unsigned int EncodeGradientMagnitude(const float& Magnitude)
+{
+	const int NoMantissaSteps = 1 << GRADIENT_MAGNITUDE_MANTISSA_BITS;
+	const int MaxExponent = (1 << GRADIENT_MAGNITUDE_EXPONENT_BITS) - 1;
+
+	// Values below two are stored linearly
+	if (Magnitude < 2.0f)
+		return (unsigned int)(Magnitude * 0.5f * (float)NoMantissaSteps + 0.5f);
+
+	union
+	{
+		float f;
+		unsigned int ui;
+	} Value;
+
+	Value.f = Magnitude;
+
+	// Round the mantissa to GRADIENT_MAGNITUDE_MANTISSA_BITS bits, a carry correctly increments the exponent
+	const unsigned int Rounded = Value.ui + (1 << (22 - GRADIENT_MAGNITUDE_MANTISSA_BITS));
+
+	const int Exponent = (int)(Rounded >> 23) - 127;
+
+	if (Exponent > MaxExponent)
+		return (MaxExponent << GRADIENT_MAGNITUDE_MANTISSA_BITS) | (NoMantissaSteps - 1);
+
+	return (Exponent << GRADIENT_MAGNITUDE_MANTISSA_BITS) | ((Rounded >> (23 - GRADIENT_MAGNITUDE_MANTISSA_BITS)) & (NoMantissaSteps - 1));
+}
+
+/*! Decodes a gradient magnitude encoded with EncodeGradientMagnitude
+	@param[in] Encoded Encoded gradient magnitude
+	@return Gradient magnitude
+*/
+HOST_DEVICE inline float DecodeGradientMagnitude(const unsigned int& Encoded)
+{
+	const float InvNoMantissaSteps = 1.0f / (float)(1 << GRADIENT_MAGNITUDE_MANTISSA_BITS);
+
+	const int Exponent	= Encoded >> GRADIENT_MAGNITUDE_MANTISSA_BITS;
+	const int Mantissa	= Encoded & ((1 << GRADIENT_MAGNITUDE_MANTISSA_BITS) - 1);
+
+	if (Exponent == 0)
+		return 2.0f * (float)Mantissa * InvNoMantissaSteps;
+
+	return ldexpf(1.0f + (float)Mantissa * InvNoMantissaSteps, Exponent);
+}
+
+/*! \class GradientVolume
+ * \brief Precomputed central difference gradients at the voxel centers, every voxel packs an octahedral encoded normal and an encoded gradient magnitude in 32 bits so that shading costs a single fetch. The gradients are computed by the VolumePreprocessor
+ */
+class EXPOSURE_RENDER_DLL GradientVolume
+{
+public:
+	/*! Default constructor */
+	HOST GradientVolume() :
+		Gradients("Device Gradients", Enums::Device, Enums::NearestNeighbour, Enums::Clamp)
+	{
+	}
+
+	/*! Assignment operator
+		@param[in] Other Gradient volume to copy
+		@return Copied gradient volume
+	*/
+	HOST GradientVolume& operator = (const GradientVolume& Other)
+	{
+		this->Gradients = Other.Gradients;
+
+		return *this;
+	}
+
+	/*! Packs central differences \a D into a normal and a magnitude
+		@param[in] D Central differences, one voxel apart
+		@return Packed gradient
+	*/
+	HOST_DEVICE static unsigned int Pack(const Vec3f& D)
+	{
+		return (EncodeGradientMagnitude(0.5f * D.Length()) << (2 * GRADIENT_NORMAL_BITS)) | EncodeOctahedral(D);
+	}
+
+	/*! Gets whether the gradient volume of a volume with \a Resolution fits in \a Budget
+		@param[in] Resolution Resolution of the volume
+		@param[in] Budget Memory budget in megabytes, zero disables the gradient volume
+		@return Whether the gradient volume fits
+	*/
+	HOST static bool FitsBudget(const Vec3i& Resolution, const float& Budget)
+	{
+		const long long NoBytes = Resolution.LongCumulativeProduct() * sizeof(unsigned int);
+
+		return NoBytes > 0 && (float)NoBytes <= Budget * 1024.0f * 1024.0f;
+	}
+
+	/*! Uploads packed gradients
+		@param[in] Gradients Host packed gradients, when empty the gradient volume is released
+	*/
+	HOST void Set(const Buffer3D<unsigned int>& Gradients)
+	{
+		if (Gradients.GetNoElements() > 0)
+			this->Gradients.Set(Enums::Host, Gradients.GetResolution(), Gradients.GetData());
+		else
+			this->Gradients.Free();
+	}
+
+	/*! Gets whether the gradient volume has been built
+		@return Whether gradients can be looked up
+	*/
+	HOST_DEVICE bool GetBuilt() const
+	{
+		return this->Gradients.GetNoElements() > 0;
+	}
+
+	/*! Gets the normalized gradient of the voxel nearest to \a NormalizedXYZ
+		@param[in] NormalizedXYZ Normalized position
+		@return Normalized gradient
+	*/
+	HOST_DEVICE Vec3f GetNormal(const Vec3f& NormalizedXYZ) const
+	{
+		return DecodeOctahedral(this->Fetch(NormalizedXYZ));
+	}
+
+	/*! Gets the gradient magnitude of the voxel nearest to \a NormalizedXYZ
+		@param[in] NormalizedXYZ Normalized position
+		@return Gradient magnitude
+	*/
+	HOST_DEVICE float GetMagnitude(const Vec3f& NormalizedXYZ) const
+	{
+		return DecodeGradientMagnitude(this->Fetch(NormalizedXYZ) >> (2 * GRADIENT_NORMAL_BITS));
+	}
+
+protected:
+	/*! Fetches the packed gradient of the voxel nearest to \a NormalizedXYZ
+		@param[in] NormalizedXYZ Normalized position
+		@return Packed gradient
+	*/
+	HOST_DEVICE unsigned int Fetch(const Vec3f& NormalizedXYZ) const
+	{
+		const Vec3i Resolution = this->Gradients.GetResolution();
+
+		return this->Gradients((int)floorf(NormalizedXYZ[0] * (float)Resolution[0]), (int)floorf(NormalizedXYZ[1] * (float)Resolution[1]), (int)floorf(NormalizedXYZ[2] * (float)Resolution[2]));
+	}
+
+	Buffer3D<unsigned int>		Gradients;				/*! Packed normals and magnitudes */
+};
+
+}
@@ -1,146 +1,339 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "hostbase.h"
-#include "vector.h"
-#include "buffer3d.h"
-#include "alignment.h"
-
-namespace ExposureRender
-{
-
-/*! Exposure Render host volume class */
-class EXPOSURE_RENDER_DLL HostVolume : public HostBase
-{
-public:
-	/*! Default constructor */
-	HOST HostVolume() :
-		HostBase(),
-		Alignment(),
-		Voxels("Host Voxels", Enums::Host),
-		NormalizeSize(false),
-		Spacing(1.0f),
-		AcceleratorType(Enums::Octree)
-	{
-	}
-	
-	/*! Copy constructor
-		@param[in] Other Host volume to copy
-	*/
-	HOST HostVolume(const HostVolume& Other) :
-		HostBase(),
-		Alignment(),
-		Voxels("Host Voxels", Enums::Host),
-		NormalizeSize(false),
-		Spacing(1.0f),
-		AcceleratorType(Enums::Octree)
-	{
-		*this = Other;
-	}
-	
-	/*! Assignment operator
-		@param[in] Other Host volume to copy
-		@return Copied host volume
-	*/
-	HOST HostVolume& HostVolume::operator = (const HostVolume& Other)
-	{
-		HostBase::operator = (Other);
-
-		this->Alignment			= Other.Alignment;
-		this->Voxels			= Other.Voxels;
-		this->NormalizeSize		= Other.NormalizeSize;
-		this->Spacing			= Other.Spacing;
-		this->AcceleratorType	= Other.AcceleratorType;
-
-		return *this;
-	}
-	
-	/*! Binds voxels to the volume
-		@param[in] Resolution Resolution of the volume
-		@param[in] Spacing Spacing of the volume
-		@param[in] Voxels Voxels of the volume
-		@param[in] NormalizeSize Whether access is normalized
-	*/
-	HOST void BindVoxels(const Vec3i& Resolution, const Vec3f& Spacing, unsigned short* Voxels, const bool& NormalizeSize = false)
-	{
-		this->Voxels.Set(Enums::Host, Resolution, Voxels);
-
-		this->NormalizeSize	= NormalizeSize;
-		this->Spacing		= Spacing;
-	}
-
-	/*! Computes the maximum gradient magnitude
-		@return Maximum gradient magnitude
-	*/
-	HOST float GetMaximumGradientMagnitude() const
-	{
-		float MaximumGradientMagnitude = 0.0f;
-
-		const Vec3i Resolution = this->Voxels.GetResolution();
-		
-		const int Coarseness = 3;
-		
-		const Vec3f HalfSpacing = 0.5f / this->Spacing;
-
-		for (int x = 0; x < Resolution[0]; x += Coarseness)
-		{
-			for (int y = 0; y < Resolution[1]; y += Coarseness)
-			{
-				for (int z = 0; z < Resolution[2]; z += Coarseness)
-				{
-					float Sum = 0.0f, D = 0.0f;
-
-					D = (float)(this->Voxels(min(x + 1, Resolution[0] - 1), y, z) - this->Voxels(max(x - 1, 0), y, z)) * HalfSpacing[0];
-					Sum += D * D;
-
-					D = (float)(this->Voxels(x, min(y + 1, Resolution[1] - 1), z) - this->Voxels(x, max(y - 1, 0), z)) * HalfSpacing[1];
-					Sum += D * D;
-
-					D = (float)(this->Voxels(x, y, min(z + 1, Resolution[2] - 1)) - this->Voxels(x, y, max(z - 1, 0))) * HalfSpacing[2];
-					Sum += D * D;
-
-					const float GradientMagnitude = sqrtf(Sum);
-
-					if (GradientMagnitude > MaximumGradientMagnitude)
-						MaximumGradientMagnitude = GradientMagnitude;
-				}
-			}
-		}
-		
-		return MaximumGradientMagnitude;
-	}
-	
-	GET_MACRO(HOST, Alignment, Alignment)
-	GET_REF_MACRO(HOST, Alignment, Alignment)
-	SET_MACRO(HOST, Alignment, Alignment)
-	GET_REF_MACRO(HOST, Voxels, Buffer3D<unsigned short>)
-	GET_SET_MACRO(HOST, NormalizeSize, bool)
-	GET_SET_MACRO(HOST, Spacing, Vec3f)
-	GET_SET_MACRO(HOST, AcceleratorType, Enums::AcceleratorType)
-
-protected:
-	Alignment					Alignment;				/*! Alignment */
-	Buffer3D<unsigned short>	Voxels;					/*! Voxels */
-	bool						NormalizeSize;			/*! Normalized access */
-	Vec3f						Spacing;				/*! Spacing */
-	Enums::AcceleratorType		AcceleratorType;		/*! Accelerator type */
-
-	friend class Volume;
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "hostbase.h"
+#include "vector.h"
+#include "buffer3d.h"
+#include "alignment.h"
+#include "mappedfile.h"
+#include "voxeltype.h"
+
+#include <memory>
+#include <vector>
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+namespace ExposureRender
+{
+
+/*! Exposure Render host volume class */
+class EXPOSURE_RENDER_DLL HostVolume : public HostBase
+{
+public:
+	/*! Default constructor */
+	HOST HostVolume() :
+		HostBase(),
+		Alignment(),
+		Voxels("Host Voxels", Enums::Host),
+		NativeVoxels("Host Native Voxels", Enums::Host),
+		VoxelType(Enums::UnsignedShort),
+		VoxelRange(0.0f),
+		NormalizeSize(false),
+		Spacing(1.0f),
+		AcceleratorType(Enums::MacrocellGrid),
+		VoxelLayout(Enums::Scanline),
+		GradientBudget(0.0f),
+		StreamingBudget(0.0f),
+		NoLevels(1),
+		VoxelFile()
+	{
+		this->CacheDirectory[0] = '\0';
+	}
+	
+	/*! Copy constructor
+		@param[in] Other Host volume to copy
+	*/
+	HOST HostVolume(const HostVolume& Other) :
+		HostBase(),
+		Alignment(),
+		Voxels("Host Voxels", Enums::Host),
+		NativeVoxels("Host Native Voxels", Enums::Host),
+		VoxelType(Enums::UnsignedShort),
+		VoxelRange(0.0f),
+		NormalizeSize(false),
+		Spacing(1.0f),
+		AcceleratorType(Enums::MacrocellGrid),
+		VoxelLayout(Enums::Scanline),
+		GradientBudget(0.0f),
+		StreamingBudget(0.0f),
+		NoLevels(1),
+		VoxelFile()
+	{
+		this->CacheDirectory[0] = '\0';
+		*this = Other;
+	}
+	
+	/*! Assignment operator
+		@param[in] Other Host volume to copy
+		@return Copied host volume
+	*/
+	HOST HostVolume& operator = (const HostVolume& Other)
+	{
+		HostBase::operator = (Other);
+
+		this->Alignment			= Other.Alignment;
+		this->VoxelFile			= Other.VoxelFile;
+		this->Voxels			= Other.Voxels;
+		this->NativeVoxels		= Other.NativeVoxels;
+		this->VoxelType			= Other.VoxelType;
+		this->VoxelRange		= Other.VoxelRange;
+		this->NormalizeSize		= Other.NormalizeSize;
+		this->Spacing			= Other.Spacing;
+		this->AcceleratorType	= Other.AcceleratorType;
+		this->VoxelLayout		= Other.VoxelLayout;
+		this->GradientBudget	= Other.GradientBudget;
+		this->StreamingBudget	= Other.StreamingBudget;
+		this->NoLevels			= Other.NoLevels;
+
+		this->SetCacheDirectory(Other.CacheDirectory);
+
+		return *this;
+	}
+	
+	/*! Binds voxels to the volume
+		@param[in] Resolution Resolution of the volume
+		@param[in] Spacing Spacing of the volume
+		@param[in] Voxels Voxels of the volume
+		@param[in] NormalizeSize Whether access is normalized
+	*/
+	HOST void BindVoxels(const Vec3i& Resolution, const Vec3f& Spacing, unsigned short* Voxels, const bool& NormalizeSize = false)
+	{
+		this->Voxels.Set(Enums::Host, Resolution, Voxels);
+		this->NativeVoxels.Free();
+		this->VoxelFile.reset();
+
+		this->VoxelType		= Enums::UnsignedShort;
+		this->VoxelRange	= Vec2f(0.0f);
+		this->NormalizeSize	= NormalizeSize;
+		this->Spacing		= Spacing;
+	}
+
+	/*! Binds voxels of \a VoxelType to the volume, they are kept in their native width and mapped to the 16-bit intensity domain while sampling (see VoxelTraits)
+		@param[in] Resolution Resolution of the volume
+		@param[in] Spacing Spacing of the volume
+		@param[in] Voxels Voxels of the volume
+		@param[in] VoxelType Type of the voxels
+		@param[in] NormalizeSize Whether access is normalized
+	*/
+	HOST void BindVoxels(const Vec3i& Resolution, const Vec3f& Spacing, void* Voxels, const Enums::VoxelType& VoxelType, const bool& NormalizeSize = false)
+	{
+		if (VoxelType == Enums::UnsignedShort)
+		{
+			this->BindVoxels(Resolution, Spacing, (unsigned short*)Voxels, NormalizeSize);
+			return;
+		}
+
+		this->NativeVoxels.Set(Enums::Host, GetNativeResolution(Resolution, VoxelType), (unsigned char*)Voxels);
+		this->Voxels.Free();
+		this->VoxelFile.reset();
+
+		this->VoxelType		= VoxelType;
+		this->VoxelRange	= ComputeVoxelRange(this->NativeVoxels.GetData(), Resolution, VoxelType);
+		this->NormalizeSize	= NormalizeSize;
+		this->Spacing		= Spacing;
+	}
+
+	/*! Maps the voxels of a raw file into memory, the voxel buffer references the mapping instead of a copy so binding costs no reads and no duplicate memory
+		@param[in] pFileName Name of the raw file, little endian voxels in scanline order
+		@param[in] Offset Offset of the first voxel in bytes
+		@param[in] Resolution Resolution of the volume
+		@param[in] Spacing Spacing of the volume
+		@param[in] NormalizeSize Whether access is normalized
+		@param[in] VoxelType Type of the voxels, only unsigned short voxels can be streamed
+	*/
+	HOST void MapVoxels(const char* pFileName, const long long& Offset, const Vec3i& Resolution, const Vec3f& Spacing, const bool& NormalizeSize = false, const Enums::VoxelType& VoxelType = Enums::UnsignedShort)
+	{
+		std::shared_ptr<MappedFile> VoxelFile(new MappedFile(pFileName));
+
+		const int VoxelSize = GetVoxelSize(VoxelType);
+
+		const long long NoBytes = (long long)Resolution[0] * Resolution[1] * Resolution[2] * VoxelSize;
+
+		if (Offset < 0 || Offset % VoxelSize != 0 || Offset + NoBytes > VoxelFile->GetSize())
+		{
+			char Message[MAX_CHAR_SIZE];
+			sprintf_s(Message, MAX_CHAR_SIZE, "%s does not contain %d x %d x %d voxels at offset %lld", pFileName, Resolution[0], Resolution[1], Resolution[2], Offset);
+			throw(Exception(Enums::Error, Message));
+		}
+
+		if (VoxelType == Enums::UnsignedShort)
+		{
+			this->Voxels.Wrap(Resolution, (unsigned short*)(VoxelFile->GetData() + Offset));
+			this->NativeVoxels.Free();
+			this->VoxelRange = Vec2f(0.0f);
+		}
+		else
+		{
+			this->NativeVoxels.Wrap(GetNativeResolution(Resolution, VoxelType), (unsigned char*)(VoxelFile->GetData() + Offset));
+			this->Voxels.Free();
+			this->VoxelRange = ComputeVoxelRange(this->NativeVoxels.GetData(), Resolution, VoxelType);
+		}
+
+		this->VoxelFile = VoxelFile;
+
+		this->VoxelType		= VoxelType;
+		this->NormalizeSize	= NormalizeSize;
+		this->Spacing		= Spacing;
+	}
+
+	/*! Gets the resolution of the volume
+		@return Resolution
+	*/
+	HOST Vec3i GetResolution() const
+	{
+		if (this->VoxelType == Enums::UnsignedShort)
+			return this->Voxels.GetResolution();
+
+		const Vec3i NativeResolution = this->NativeVoxels.GetResolution();
+
+		return Vec3i(NativeResolution[0] / GetVoxelSize(this->VoxelType), NativeResolution[1], NativeResolution[2]);
+	}
+
+	/*! Gets the time stamp of the voxels
+		@return Time stamp of the buffer which holds the voxels
+	*/
+	HOST const TimeStamp& GetVoxelsTimeStamp() const
+	{
+		return this->VoxelType == Enums::UnsignedShort ? this->Voxels.TimeStamp : this->NativeVoxels.TimeStamp;
+	}
+
+	/*! Gets the voxels for the passes which derive data from them
+		@return Voxel source
+	*/
+	HOST VoxelSource GetVoxelSource() const
+	{
+		if (this->VoxelType == Enums::UnsignedShort)
+			return VoxelSource(this->Voxels.GetData(), this->Voxels.GetResolution());
+
+		return VoxelSource(this->NativeVoxels.GetData(), this->VoxelType, this->GetResolution(), this->VoxelRange);
+	}
+
+	GET_MACRO(HOST, Alignment, Alignment)
+	GET_REF_MACRO(HOST, Alignment, Alignment)
+	SET_MACRO(HOST, Alignment, Alignment)
+	GET_REF_MACRO(HOST, Voxels, Buffer3D<unsigned short>)
+	GET_REF_MACRO(HOST, NativeVoxels, Buffer3D<unsigned char>)
+	GET_MACRO(HOST, VoxelType, Enums::VoxelType)
+	GET_MACRO(HOST, VoxelRange, Vec2f)
+	GET_SET_MACRO(HOST, NormalizeSize, bool)
+	GET_SET_MACRO(HOST, Spacing, Vec3f)
+	GET_SET_MACRO(HOST, AcceleratorType, Enums::AcceleratorType)
+	GET_SET_MACRO(HOST, VoxelLayout, Enums::VoxelLayout)
+	GET_SET_MACRO(HOST, GradientBudget, float)
+	GET_SET_MACRO(HOST, StreamingBudget, float)
+	GET_SET_MACRO(HOST, NoLevels, int)
+
+	/*! Gets the directory in which derived volume data is cached
+		@return Cache directory, empty when caching is disabled
+	*/
+	HOST const char* GetCacheDirectory() const
+	{
+		return this->CacheDirectory;
+	}
+
+	/*! Sets the directory in which derived volume data is cached
+		@param[in] pCacheDirectory Cache directory, empty or NULL disables caching
+	*/
+	HOST void SetCacheDirectory(const char* pCacheDirectory)
+	{
+		sprintf_s(this->CacheDirectory, MAX_CHAR_SIZE, "%s", pCacheDirectory ? pCacheDirectory : "");
+	}
+
+protected:
+	/*! Gets the resolution of the buffer which holds voxels of \a VoxelType, whose rows are bytes
+		@param[in] Resolution Resolution of the volume
+		@param[in] VoxelType Type of the voxels
+		@return Resolution of the byte buffer
+	*/
+	HOST static Vec3i GetNativeResolution(const Vec3i& Resolution, const Enums::VoxelType& VoxelType)
+	{
+		return Vec3i(Resolution[0] * GetVoxelSize(VoxelType), Resolution[1], Resolution[2]);
+	}
+
+	/*! Computes the range of floating point voxels, which is spread over the 16-bit intensity domain. Slices are scanned in parallel
+		@param[in] pVoxels Voxels
+		@param[in] Resolution Resolution of the volume
+		@param[in] VoxelType Type of the voxels
+		@return Minimum and maximum, zero for integer voxels
+	*/
+	HOST static Vec2f ComputeVoxelRange(const unsigned char* pVoxels, const Vec3i& Resolution, const Enums::VoxelType& VoxelType)
+	{
+		if (VoxelType != Enums::Half && VoxelType != Enums::Float)
+			return Vec2f(0.0f);
+
+		const long long NoSliceVoxels = (long long)Resolution[0] * Resolution[1];
+
+		std::vector<Vec2f> SliceRanges(max(Resolution[2], 0), Vec2f(FLT_MAX, -FLT_MAX));
+
+		const auto ScanSlice = [&](int Z)
+		{
+			Vec2f& SliceRange = SliceRanges[Z];
+
+			for (long long i = Z * NoSliceVoxels; i < (Z + 1) * NoSliceVoxels; i++)
+			{
+				const float Value = VoxelType == Enums::Half ? ToFloat(((const HalfFloat*)pVoxels)[i]) : ((const float*)pVoxels)[i];
+
+				// Skip NaNs and infinities
+				if (Value - Value != 0.0f)
+					continue;
+
+				SliceRange[0] = min(SliceRange[0], Value);
+				SliceRange[1] = max(SliceRange[1], Value);
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(Resolution[2], ScanSlice);
+#else
+		for (int Z = 0; Z < Resolution[2]; Z++)
+			ScanSlice(Z);
+#endif
+
+		Vec2f Range(FLT_MAX, -FLT_MAX);
+
+		for (int Z = 0; Z < Resolution[2]; Z++)
+		{
+			Range[0] = min(Range[0], SliceRanges[Z][0]);
+			Range[1] = max(Range[1], SliceRanges[Z][1]);
+		}
+
+		return Range[0] <= Range[1] ? Range : Vec2f(0.0f);
+	}
+
+	Alignment					Alignment;				/*! Alignment */
+	Buffer3D<unsigned short>	Voxels;					/*! Voxels of type unsigned short */
+	Buffer3D<unsigned char>		NativeVoxels;			/*! Voxels of the other voxel types as bytes, each row holds the bytes of a row of voxels */
+	Enums::VoxelType			VoxelType;				/*! Type of the voxels */
+	Vec2f						VoxelRange;				/*! Range of floating point voxels */
+	bool						NormalizeSize;			/*! Normalized access */
+	Vec3f						Spacing;				/*! Spacing */
+	Enums::AcceleratorType		AcceleratorType;		/*! Accelerator type */
+	Enums::VoxelLayout			VoxelLayout;			/*! Order of the voxels in device memory */
+	float						GradientBudget;			/*! Memory budget of the precomputed gradient volume in megabytes, zero disables it */
+	float						StreamingBudget;		/*! Memory budget of the voxels in megabytes, larger memory mapped volumes are streamed through a brick cache, zero disables streaming */
+	int							NoLevels;				/*! Number of levels of the mip pyramid for level of detail sampling, one disables the pyramid */
+	char						CacheDirectory[MAX_CHAR_SIZE];	/*! Directory of the derived volume data cache, empty disables it */
+	std::shared_ptr<MappedFile>	VoxelFile;				/*! Memory mapped file the voxels reference, if any */
+
+	friend class Volume;
+	friend class BrickCache;
+};
+
+}
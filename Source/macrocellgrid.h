@@ -0,0 +1,434 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "buffer3d.h"
+#include "boundingbox.h"
+#include "buffer1d.h"
+#include "transferfunction1d.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define MACROCELL_SIZE				8
+#define MACROCELL_NO_INTENSITIES	(USHRT_MAX + 1)
+
+/*! \class MacrocellGrid
+ * \brief Coarse grid which stores the intensity range of blocks of voxels. Under the current opacity transfer function every cell also holds the maximum opacity in its range, which bounds the density (majorant) for delta tracking and lets rays skip fully transparent cells. The intensity ranges do not depend on the transfer function, so an edit of the transfer function only updates the cells whose range overlaps the intensities at which the opacity changed
+ */
+class EXPOSURE_RENDER_DLL MacrocellGrid
+{
+public:
+	/*! Default constructor */
+	HOST MacrocellGrid() :
+		MinIntensity("Macrocell Minimum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxIntensity("Macrocell Maximum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxOpacity("Macrocell Maximum Opacity", Enums::Device, Enums::NearestNeighbour, Enums::Clamp),
+		HostMaxOpacity("Host Macrocell Maximum Opacity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		OpacityRanges("Macrocell Opacity Ranges", Enums::Host),
+		ChangedRange(0, USHRT_MAX),
+		VoxelsTimeStamp(),
+		Classified(false),
+		MinP(0.0f),
+		InvCellSize(0.0f),
+		CellSize(0.0f)
+	{
+	}
+
+	/*! Assignment operator
+		@param[in] Other Macrocell grid to copy
+		@return Copied macrocell grid
+	*/
+	HOST MacrocellGrid& operator = (const MacrocellGrid& Other)
+	{
+		this->MinIntensity		= Other.MinIntensity;
+		this->MaxIntensity		= Other.MaxIntensity;
+		this->MaxOpacity		= Other.MaxOpacity;
+		this->HostMaxOpacity	= Other.HostMaxOpacity;
+		this->OpacityRanges		= Other.OpacityRanges;
+		this->ChangedRange		= Other.ChangedRange;
+		this->VoxelsTimeStamp	= Other.VoxelsTimeStamp;
+		this->Classified		= Other.Classified;
+		this->MinP				= Other.MinP;
+		this->InvCellSize		= Other.InvCellSize;
+		this->CellSize			= Other.CellSize;
+
+		return *this;
+	}
+
+	/*! Sets the placement of the cells for a volume with \a Resolution voxels inside \a BoundingBox
+		@param[in] Resolution Resolution of the volume
+		@param[in] BoundingBox Bounding box of the volume
+	*/
+	HOST void SetGeometry(const Vec3i& Resolution, const BoundingBox& BoundingBox)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			this->CellSize[i]		= BoundingBox.GetSize()[i] * (float)MACROCELL_SIZE / (float)Resolution[i];
+			this->InvCellSize[i]	= 1.0f / this->CellSize[i];
+		}
+
+		this->MinP = BoundingBox.GetMinP();
+	}
+
+	/*! Sets the intensity ranges of the cells, computed by the VolumePreprocessor. The range of a cell includes the voxels directly around it so that every trilinear sample taken inside the cell lies within the range
+		@param[in] MinIntensity Minimum intensity per cell
+		@param[in] MaxIntensity Maximum intensity per cell
+		@param[in] VoxelsTimeStamp Time stamp of the voxels the ranges were computed from
+	*/
+	HOST void SetRanges(const Buffer3D<unsigned short>& MinIntensity, const Buffer3D<unsigned short>& MaxIntensity, const TimeStamp& VoxelsTimeStamp)
+	{
+		const Vec3i GridResolution = MinIntensity.GetResolution();
+
+		this->MinIntensity.Set(Enums::Host, GridResolution, MinIntensity.GetData());
+		this->MaxIntensity.Set(Enums::Host, GridResolution, MaxIntensity.GetData());
+
+		// Until the grid is classified no cell is considered empty
+		std::vector<float> MaxOpacity(GridResolution.CumulativeProduct(), FLT_MAX);
+
+		this->MaxOpacity.Set(Enums::Host, GridResolution, &MaxOpacity[0]);
+		this->HostMaxOpacity.Set(Enums::Host, GridResolution, &MaxOpacity[0]);
+
+		this->VoxelsTimeStamp	= VoxelsTimeStamp;
+		this->Classified		= false;
+	}
+
+	/*! Computes the maximum opacity of every cell under \a Opacity. The renderer truncates intensities before evaluating the opacity, so only the integer intensities in the range of a cell have to be considered, their maximum comes from a sparse table of range maxima. Once the grid is classified, only the part of the table and the cells which cover the intensities at which the opacity changed are updated
+		@param[in] Opacity Opacity transfer function
+	*/
+	HOST void Classify(const ScalarTransferFunction1D& Opacity)
+	{
+		const Vec3i GridResolution = this->MinIntensity.GetResolution();
+
+		const int NoCells = GridResolution.CumulativeProduct();
+
+		if (NoCells <= 0)
+			return;
+
+		int NoRanges = 1;
+
+		while ((1 << NoRanges) <= MACROCELL_NO_INTENSITIES)
+			NoRanges++;
+
+		std::vector<float> Opacities(MACROCELL_NO_INTENSITIES);
+
+		for (int i = 0; i < MACROCELL_NO_INTENSITIES; i++)
+			Opacities[i] = Opacity.Evaluate((float)i);
+
+		const bool Incremental = this->Classified && this->OpacityRanges.GetNoElements() == NoRanges * MACROCELL_NO_INTENSITIES;
+
+		// Table[k][i] holds the maximum opacity over the intensities [i, i + 2^k), the first row holds the opacities of the previous classification
+		if (!Incremental)
+			this->OpacityRanges.Resize(Vec<int, 1>(NoRanges * MACROCELL_NO_INTENSITIES));
+
+		float* pTable = this->OpacityRanges.GetData();
+
+		this->ChangedRange = Vec2i(0, USHRT_MAX);
+
+		if (Incremental)
+		{
+			int& Lo = this->ChangedRange[0];
+			int& Hi = this->ChangedRange[1];
+
+			while (Lo <= USHRT_MAX && Opacities[Lo] == pTable[Lo])
+				Lo++;
+
+			if (Lo > USHRT_MAX)
+			{
+				this->ChangedRange = Vec2i(1, 0);
+				return;
+			}
+
+			while (Opacities[Hi] == pTable[Hi])
+				Hi--;
+		}
+
+		const int Lo = this->ChangedRange[0];
+		const int Hi = this->ChangedRange[1];
+
+		memcpy(pTable + Lo, &Opacities[Lo], (Hi - Lo + 1) * sizeof(float));
+
+		// Only the ranges which overlap the changed intensities change
+		for (int k = 1; k < NoRanges; k++)
+		{
+			float* pRange		= pTable + k * MACROCELL_NO_INTENSITIES;
+			const float* pHalf	= pTable + (k - 1) * MACROCELL_NO_INTENSITIES;
+
+			for (int i = max(Lo - (1 << k) + 1, 0); i <= Hi && i + (1 << k) <= MACROCELL_NO_INTENSITIES; i++)
+				pRange[i] = max(pHalf[i], pHalf[i + (1 << (k - 1))]);
+		}
+
+		const unsigned short* pMin = this->MinIntensity.GetData();
+		const unsigned short* pMax = this->MaxIntensity.GetData();
+
+		float* pMaxOpacity = this->HostMaxOpacity.GetData();
+
+		const int NoSlabCells = GridResolution[0] * GridResolution[1];
+
+		// First and last cell of every slab whose maximum opacity changed
+		std::vector<Vec2i> ChangedCells(GridResolution[2], Vec2i(NoCells, -1));
+
+		const auto ClassifySlab = [&](int Z)
+		{
+			for (int i = Z * NoSlabCells; i < (Z + 1) * NoSlabCells; i++)
+			{
+				if (pMax[i] < Lo || pMin[i] > Hi)
+					continue;
+
+				const int Length = pMax[i] - pMin[i] + 1;
+
+				int k = 0;
+
+				while ((2 << k) <= Length)
+					k++;
+
+				const float MaxOpacity = max(pTable[k * MACROCELL_NO_INTENSITIES + pMin[i]], pTable[k * MACROCELL_NO_INTENSITIES + pMax[i] + 1 - (1 << k)]);
+
+				if (MaxOpacity == pMaxOpacity[i])
+					continue;
+
+				pMaxOpacity[i] = MaxOpacity;
+
+				ChangedCells[Z][0] = min(ChangedCells[Z][0], i);
+				ChangedCells[Z][1] = i;
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(GridResolution[2], ClassifySlab);
+#else
+		for (int Z = 0; Z < GridResolution[2]; Z++)
+			ClassifySlab(Z);
+#endif
+
+		// Only the changed part of every slab is copied to the device
+		for (int Z = 0; Z < GridResolution[2]; Z++)
+		{
+			if (ChangedCells[Z][0] > ChangedCells[Z][1])
+				continue;
+
+#if defined(__CUDACC__) || defined(ER_CPU)
+			Cuda::MemCopyHostToDevice(pMaxOpacity + ChangedCells[Z][0], this->MaxOpacity.GetData() + ChangedCells[Z][0], ChangedCells[Z][1] - ChangedCells[Z][0] + 1);
+#endif
+		}
+
+		this->MaxOpacity.Modified();
+
+		this->Classified = true;
+	}
+
+	/*! Gets the intensities at which the opacity changed in the last classification, cells and octree nodes whose intensity range does not overlap them keep their maximum opacity
+		@return Changed intensities, an empty range when the opacity did not change
+	*/
+	HOST Vec2i GetChangedRange() const
+	{
+		return this->ChangedRange;
+	}
+
+	/*! Advances \a T over the empty cells which the ray traverses from \a T onwards using a 3D digital differential analyzer, the new \a T stays on the sampling lattice T + k * \a StepSize
+		@param[in] O Ray origin
+		@param[in] D Ray direction
+		@param[in,out] T Parametric distance of the next sample
+		@param[in] StepSize Step size
+		@param[in] MaxT Maximum parametric distance
+		@return Whether \a T was advanced
+	*/
+	HOST_DEVICE bool Skip(const Vec3f& O, const Vec3f& D, float& T, const float& StepSize, const float& MaxT) const;
+
+	/*! Gets the cell which contains \a P, positions outside the grid are clamped to the nearest cell
+		@param[in] P Position in world space
+		@param[out] Cell Cell index
+	*/
+	HOST_DEVICE void GetCell(const Vec3f& P, int (&Cell)[3]) const
+	{
+		const Vec3i GridResolution = this->MaxOpacity.GetResolution();
+
+		for (int i = 0; i < 3; i++)
+			Cell[i] = Clamp((int)floorf((P[i] - this->MinP[i]) * this->InvCellSize[i]), 0, GridResolution[i] - 1);
+	}
+
+	/*! Gets the maximum opacity of a cell
+		@param[in] Cell Cell index
+		@return Maximum opacity, FLT_MAX when the grid is not classified
+	*/
+	HOST_DEVICE float GetMaxOpacity(const int (&Cell)[3]) const
+	{
+		return this->MaxOpacity(Cell[0], Cell[1], Cell[2]);
+	}
+
+	/*! Clamps \a Intensity to the intensity range of the cell which contains \a P. Samples of coarser levels of detail average voxels beyond the cell, clamping keeps their opacity below the majorant of the cell
+		@param[in] P Position in world space
+		@param[in] Intensity Intensity
+		@return Clamped intensity
+	*/
+	HOST_DEVICE float ClampIntensity(const Vec3f& P, const float& Intensity) const
+	{
+		if (this->MinIntensity.GetNoElements() <= 0)
+			return Intensity;
+
+		int Cell[3];
+
+		this->GetCell(P, Cell);
+
+		return Clamp(Intensity, (float)this->MinIntensity(Cell[0], Cell[1], Cell[2]), (float)this->MaxIntensity(Cell[0], Cell[1], Cell[2]));
+	}
+
+	GET_MACRO(HOST, Classified, bool)
+
+protected:
+	Buffer3D<unsigned short>	MinIntensity;			/*! Minimum intensity per cell */
+	Buffer3D<unsigned short>	MaxIntensity;			/*! Maximum intensity per cell */
+	Buffer3D<float>				MaxOpacity;				/*! Maximum opacity per cell */
+	Buffer3D<float>				HostMaxOpacity;			/*! Host copy of the maximum opacity per cell, which classification updates in place */
+	Buffer1D<float>				OpacityRanges;			/*! Sparse table of the maximum opacity over intensity ranges of power of two lengths */
+	Vec2i						ChangedRange;			/*! Intensities at which the opacity changed in the last classification */
+	TimeStamp					VoxelsTimeStamp;		/*! Time stamp of the voxels the grid was built from */
+	bool						Classified;				/*! Whether the empty flags reflect an opacity transfer function */
+	Vec3f						MinP;					/*! Minimum corner of the grid in world space */
+	Vec3f						InvCellSize;			/*! Inverse cell size in world space */
+	Vec3f						CellSize;				/*! Cell size in world space */
+
+	friend class Octree;
+	friend class MacrocellTraversal;
+};
+
+/*! \class MacrocellTraversal
+ * \brief Walks a ray through the cells of a macrocell grid with a 3D digital differential analyzer and returns the ray segment in each cell
+ */
+class MacrocellTraversal
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE MacrocellTraversal() :
+		pGrid(NULL),
+		T(0.0f),
+		MaxT(0.0f)
+	{
+	}
+
+	/*! Constructor
+		@param[in] Grid Macrocell grid
+		@param[in] O Ray origin
+		@param[in] D Ray direction
+		@param[in] MinT Parametric distance at which the walk starts
+		@param[in] MaxT Parametric distance at which the walk ends
+	*/
+	HOST_DEVICE MacrocellTraversal(const MacrocellGrid& Grid, const Vec3f& O, const Vec3f& D, const float& MinT, const float& MaxT) :
+		pGrid(&Grid),
+		T(MinT),
+		MaxT(MaxT)
+	{
+		Grid.GetCell(O + D * MinT, this->Cell);
+
+		for (int i = 0; i < 3; i++)
+		{
+			if (D[i] > 0.0f)
+			{
+				this->Step[i]	= 1;
+				this->NextT[i]	= (Grid.MinP[i] + (float)(this->Cell[i] + 1) * Grid.CellSize[i] - O[i]) / D[i];
+				this->DeltaT[i]	= Grid.CellSize[i] / D[i];
+			}
+			else if (D[i] < 0.0f)
+			{
+				this->Step[i]	= -1;
+				this->NextT[i]	= (Grid.MinP[i] + (float)this->Cell[i] * Grid.CellSize[i] - O[i]) / D[i];
+				this->DeltaT[i]	= -Grid.CellSize[i] / D[i];
+			}
+			else
+			{
+				this->Step[i]	= 0;
+				this->NextT[i]	= FLT_MAX;
+				this->DeltaT[i]	= 0.0f;
+			}
+		}
+	}
+
+	/*! Steps to the next cell
+		@param[out] T0 Parametric distance at which the ray enters the cell
+		@param[out] T1 Parametric distance at which the ray leaves the cell
+		@param[out] MaxOpacity Maximum opacity of the cell
+		@return Whether the ray traverses another cell
+	*/
+	HOST_DEVICE bool Next(float& T0, float& T1, float& MaxOpacity)
+	{
+		if (this->T >= this->MaxT)
+			return false;
+
+		const int Axis = this->NextT[0] < this->NextT[1] ? (this->NextT[0] < this->NextT[2] ? 0 : 2) : (this->NextT[1] < this->NextT[2] ? 1 : 2);
+
+		T0			= this->T;
+		T1			= min(max(this->NextT[Axis], this->T), this->MaxT);
+		MaxOpacity	= this->pGrid->GetMaxOpacity(this->Cell);
+
+		this->T = T1;
+
+		this->Cell[Axis]	+= this->Step[Axis];
+		this->NextT[Axis]	+= this->DeltaT[Axis];
+
+		if (this->Cell[Axis] < 0 || this->Cell[Axis] >= this->pGrid->MaxOpacity.GetResolution()[Axis])
+			this->T = this->MaxT;
+
+		return true;
+	}
+
+protected:
+	const MacrocellGrid*	pGrid;			/*! Macrocell grid */
+	int						Cell[3];		/*! Current cell */
+	int						Step[3];		/*! Cell step per axis */
+	float					NextT[3];		/*! Parametric distance to the next cell boundary per axis */
+	float					DeltaT[3];		/*! Parametric distance between cell boundaries per axis */
+	float					T;				/*! Parametric distance at which the current cell is entered */
+	float					MaxT;			/*! Parametric distance at which the walk ends */
+};
+
+HOST_DEVICE inline bool MacrocellGrid::Skip(const Vec3f& O, const Vec3f& D, float& T, const float& StepSize, const float& MaxT) const
+{
+	int Cell[3];
+
+	this->GetCell(O + D * T, Cell);
+
+	if (this->GetMaxOpacity(Cell) > 0.0f)
+		return false;
+
+	MacrocellTraversal Traversal(*this, O, D, T, MaxT);
+
+	float T0 = 0.0f, T1 = 0.0f, MaxOpacity = 0.0f, EntryT = MaxT;
+
+	while (Traversal.Next(T0, T1, MaxOpacity))
+	{
+		if (MaxOpacity > 0.0f)
+		{
+			EntryT = T0;
+			break;
+		}
+	}
+
+	if (EntryT <= T)
+		return false;
+
+	T += ceilf((EntryT - T) / StepSize) * StepSize;
+
+	return true;
+}
+
+}
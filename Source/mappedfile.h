@@ -0,0 +1,144 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "exception.h"
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+namespace ExposureRender
+{
+
+/*! \class MappedFile
+ * \brief Maps a file into memory read-only and shared, pages are read from the file on first access and stay in the page cache that all mappings of the file share
+ */
+class EXPOSURE_RENDER_DLL MappedFile
+{
+public:
+	/*! Constructor
+		@param[in] pFileName Name of the file to map
+	*/
+	HOST MappedFile(const char* pFileName) :
+		pData(NULL),
+		Size(0)
+	{
+		char Message[MAX_CHAR_SIZE];
+
+#ifdef _WIN32
+		HANDLE File = CreateFileA(pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		LARGE_INTEGER FileSize;
+
+		if (File == INVALID_HANDLE_VALUE || !GetFileSizeEx(File, &FileSize))
+		{
+			if (File != INVALID_HANDLE_VALUE)
+				CloseHandle(File);
+
+			sprintf_s(Message, MAX_CHAR_SIZE, "Unable to open %s", pFileName);
+			throw(Exception(Enums::Error, Message));
+		}
+
+		this->Size = FileSize.QuadPart;
+
+		HANDLE Mapping = this->Size > 0 ? CreateFileMappingA(File, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+
+		if (Mapping)
+		{
+			this->pData = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(Mapping);
+		}
+
+		CloseHandle(File);
+
+		if (!this->pData)
+		{
+			sprintf_s(Message, MAX_CHAR_SIZE, "Unable to map %s", pFileName);
+			throw(Exception(Enums::Error, Message));
+		}
+#else
+		const int File = open(pFileName, O_RDONLY);
+
+		struct stat FileStatus;
+
+		if (File < 0 || fstat(File, &FileStatus) != 0)
+		{
+			if (File >= 0)
+				close(File);
+
+			sprintf_s(Message, MAX_CHAR_SIZE, "Unable to open %s", pFileName);
+			throw(Exception(Enums::Error, Message));
+		}
+
+		this->Size = (long long)FileStatus.st_size;
+
+		void* pMapping = this->Size > 0 ? mmap(NULL, (size_t)this->Size, PROT_READ, MAP_SHARED, File, 0) : MAP_FAILED;
+
+		close(File);
+
+		if (pMapping == MAP_FAILED)
+		{
+			sprintf_s(Message, MAX_CHAR_SIZE, "Unable to map %s", pFileName);
+			throw(Exception(Enums::Error, Message));
+		}
+
+		this->pData = pMapping;
+#endif
+	}
+
+	/*! Destructor */
+	HOST ~MappedFile()
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(this->pData);
+#else
+		munmap(this->pData, (size_t)this->Size);
+#endif
+	}
+
+	/*! Gets the mapped data
+		@return Pointer to the first byte of the file
+	*/
+	HOST const unsigned char* GetData() const
+	{
+		return (const unsigned char*)this->pData;
+	}
+
+	GET_MACRO(HOST, Size, long long)
+
+private:
+	/*! Mappings cannot be copied */
+	HOST MappedFile(const MappedFile& Other);
+
+	/*! Mappings cannot be copied */
+	HOST MappedFile& operator = (const MappedFile& Other);
+
+	void*			pData;			/*! Start of the mapping */
+	long long		Size;			/*! Size of the file in bytes */
+};
+
+}
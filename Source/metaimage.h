@@ -0,0 +1,155 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "hostvolume.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+namespace ExposureRender
+{
+
+/*! Loads a MetaImage (.mhd header with a .raw or local data file) into \a Volume by memory mapping the voxel data, only uncompressed, little endian, single channel MET_UCHAR, MET_SHORT, MET_USHORT and MET_FLOAT images are supported
+	@param[in] pFileName Name of the MetaImage header
+	@param[out] Volume Volume that receives the mapped voxels
+	@param[in] NormalizeSize Whether access is normalized
+*/
+HOST inline void LoadMetaImage(const char* pFileName, HostVolume& Volume, const bool& NormalizeSize = false)
+{
+	char Message[MAX_CHAR_SIZE];
+
+	FILE* pFile = fopen(pFileName, "rb");
+
+	if (!pFile)
+	{
+		sprintf_s(Message, MAX_CHAR_SIZE, "Unable to open %s", pFileName);
+		throw(Exception(Enums::Error, Message));
+	}
+
+	int NoDimensions = 3, NoChannels = 1;
+	Vec3i Resolution;
+	Vec3f Spacing(1.0f);
+	long long HeaderSize = 0;
+	bool Compressed = false, BigEndian = false, Supported = true;
+	char ElementType[MAX_CHAR_SIZE] = "MET_USHORT", DataFile[MAX_CHAR_SIZE] = "";
+
+	char Line[1024];
+
+	// ElementDataFile is the last field of the header
+	while (DataFile[0] == '\0' && fgets(Line, sizeof(Line), pFile))
+	{
+		char* pSeparator = strchr(Line, '=');
+
+		if (!pSeparator)
+			continue;
+
+		*pSeparator = '\0';
+
+		char Key[MAX_CHAR_SIZE], Value[MAX_CHAR_SIZE];
+
+		if (sscanf(Line, "%255s", Key) != 1)
+			continue;
+
+		const char* pValue = pSeparator + 1;
+
+		while (*pValue == ' ' || *pValue == '\t')
+			pValue++;
+
+		sprintf_s(Value, MAX_CHAR_SIZE, "%s", pValue);
+		Value[strcspn(Value, "\r\n")] = '\0';
+
+		const bool True = Value[0] == 'T' || Value[0] == 't' || Value[0] == '1';
+
+		if (strcmp(Key, "NDims") == 0)
+			NoDimensions = atoi(Value);
+		else if (strcmp(Key, "DimSize") == 0)
+			Supported &= sscanf(Value, "%d %d %d", &Resolution[0], &Resolution[1], &Resolution[2]) == 3;
+		else if (strcmp(Key, "ElementSpacing") == 0 || strcmp(Key, "ElementSize") == 0)
+			Supported &= sscanf(Value, "%f %f %f", &Spacing[0], &Spacing[1], &Spacing[2]) == 3;
+		else if (strcmp(Key, "ElementType") == 0)
+			sscanf(Value, "%255s", ElementType);
+		else if (strcmp(Key, "ElementNumberOfChannels") == 0)
+			NoChannels = atoi(Value);
+		else if (strcmp(Key, "HeaderSize") == 0)
+			HeaderSize = atoll(Value);
+		else if (strcmp(Key, "CompressedData") == 0)
+			Compressed = True;
+		else if (strcmp(Key, "ElementByteOrderMSB") == 0 || strcmp(Key, "BinaryDataByteOrderMSB") == 0)
+			BigEndian = True;
+		else if (strcmp(Key, "ElementDataFile") == 0)
+			sprintf_s(DataFile, MAX_CHAR_SIZE, "%s", Value);
+	}
+
+	// Local data directly follows the header
+	const long long LocalOffset = ftell(pFile);
+
+	fclose(pFile);
+
+	Enums::VoxelType VoxelType = Enums::UnsignedShort;
+
+	if (strcmp(ElementType, "MET_UCHAR") == 0)
+		VoxelType = Enums::UnsignedChar;
+	else if (strcmp(ElementType, "MET_SHORT") == 0)
+		VoxelType = Enums::Short;
+	else if (strcmp(ElementType, "MET_FLOAT") == 0)
+		VoxelType = Enums::Float;
+	else if (strcmp(ElementType, "MET_USHORT") != 0)
+		Supported = false;
+
+	if (!Supported || DataFile[0] == '\0' || NoDimensions != 3 || NoChannels != 1 || Compressed || BigEndian)
+	{
+		sprintf_s(Message, MAX_CHAR_SIZE, "%s is not an uncompressed, little endian, three-dimensional MET_UCHAR, MET_SHORT, MET_USHORT or MET_FLOAT image", pFileName);
+		throw(Exception(Enums::Error, Message));
+	}
+
+	char DataFileName[MAX_CHAR_SIZE];
+
+	long long Offset = HeaderSize;
+
+	if (strcmp(DataFile, "LOCAL") == 0)
+	{
+		sprintf_s(DataFileName, MAX_CHAR_SIZE, "%s", pFileName);
+		Offset += LocalOffset;
+	}
+	else
+	{
+		// The data file is relative to the directory of the header
+		const char* pSlash = strrchr(pFileName, '/');
+		const char* pBackslash = strrchr(pFileName, '\\');
+
+		if (pBackslash > pSlash)
+			pSlash = pBackslash;
+
+		const int DirectoryLength = pSlash ? (int)(pSlash - pFileName) + 1 : 0;
+
+		sprintf_s(DataFileName, MAX_CHAR_SIZE, "%.*s%s", DirectoryLength, pFileName, DataFile);
+	}
+
+	// A header size of -1 places the voxels at the end of the data file
+	if (HeaderSize == -1)
+	{
+		MappedFile File(DataFileName);
+		Offset = File.GetSize() - (long long)Resolution[0] * Resolution[1] * Resolution[2] * GetVoxelSize(VoxelType);
+	}
+
+	Volume.MapVoxels(DataFileName, Offset, Resolution, Spacing, NormalizeSize, VoxelType);
+}
+
+}
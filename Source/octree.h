@@ -1,174 +1,375 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "defines.h"
-#include "enums.h"
-#include "buffer3d.h"
-#include "boundingbox.h"
-#include <vector>
-
-namespace ExposureRender
-{
-
-class EXPOSURE_RENDER_DLL Octree
-{
-protected:
-	class OctreeNode
-	{
-	public:
-		HOST OctreeNode(const BoundingBox BoundingBox = ExposureRender::BoundingBox()) :
-			BoundingBox(BoundingBox),
-			FirstChild(-1)
-		{
-		}
-
-		HOST OctreeNode(const OctreeNode& Other)
-		{
-			*this = Other;
-		}
-
-		HOST OctreeNode& operator = (const OctreeNode& Other)
-		{
-			this->BoundingBox	= Other.BoundingBox;
-			this->FirstChild	= Other.FirstChild;
-
-			return *this;
-		}
-		
-		HOST static bool ShouldStop(const int& Depth, const int& MaxDepth)
-		{
-			if (Depth >= MaxDepth)
-				return true;
-
-			return false;
-		}
-
-		HOST void SubDivide(const Buffer3D<unsigned short>& Voxels, std::vector<OctreeNode>& Nodes, const int& Index, const int& Depth, const int& MaxDepth)
-		{
-			// test if we should stop subdividing
-			if (OctreeNode::ShouldStop(Depth, MaxDepth))
-				return;
-
-			// get the index of the first child
-			this->FirstChild = Nodes.size();
-
-			// new depth
-			int NewDepth = Depth + 1;
-
-			// calculate halfsize of bounding box
-			Vec3f HalfSize = this->BoundingBox.GetSize() / 2;
-
-			// initialize children and append to vector
-			OctreeNode Children[8];
-			Nodes.insert(Nodes.end(), &Children[0], &Children[8]);
-
-			// subdivide children
-			for (int i = 0; i < 8; i++)
-			{
-				// IMPORTANT: Nodes has been resized so "this" became unusable
-				OctreeNode* ThisNode = &Nodes[Index];
-
-				// get child index
-				int ChildIndex = ThisNode->FirstChild + i;
-				OctreeNode* ChildNode = &Nodes[ChildIndex];
-
-				// calculate child boundingbox
-				int a = i & 1;
-				int b = (i >> 1) & 1;
-				int c = (i >> 2) & 1;
-				ChildNode->BoundingBox.SetMinP(Vec3f(
-					ThisNode->BoundingBox.GetMinP()[0] + a * HalfSize[0],
-					ThisNode->BoundingBox.GetMinP()[1] + b * HalfSize[1],
-					ThisNode->BoundingBox.GetMinP()[2] + c * HalfSize[2]
-				));
-				ChildNode->BoundingBox.SetMaxP(ChildNode->BoundingBox.GetMinP() + HalfSize);
-				ChildNode->BoundingBox.Update();
-
-				// recurse
-				ChildNode->SubDivide(Voxels, Nodes, ChildIndex, NewDepth, MaxDepth);
-			}
-		}
-
-		BoundingBox		BoundingBox;
-		int				FirstChild;
-	};
-
-public:
-	HOST Octree(const int& MaxDepth = 4) :
-		MaxDepth(MaxDepth),
-		RootNode(NULL),
-		Sigma(5.0f)
-	{
-	}
-
-	HOST Octree(const Octree& Other)
-	{
-		*this = Other;
-	}
-	
-	HOST ~Octree()
-	{
-		this->Free();
-	}
-
-	HOST Octree& operator = (const Octree& Other)
-	{
-		this->MaxDepth	= Other.MaxDepth;
-		this->RootNode	= Other.RootNode;
-
-		return *this;
-	}
-
-	// Device runtime
-	DEVICE unsigned short GetIntensity(const Vec3f& P) const
-	{
-//		RootNode[RootNode[0]]
-		return 0;
-
-//		const Vec3f NormalizedXYZ = (XYZ - this->BoundingBox.MinP) * this->InvSize;
-//		return (float)USHRT_MAX * tex3D(VolumeTexture, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]);
-	}
-
-	HOST void Build(const Buffer3D<unsigned short>& Voxels, const BoundingBox& BoundingBox)
-	{
-		std::vector<OctreeNode> Nodes;
-
-		int Depth = 0;
-
-		OctreeNode Root(BoundingBox);
-		Nodes.push_back(Root);
-
-		Nodes[0].SubDivide(Voxels, Nodes, 0, Depth, this->MaxDepth);
-
-		this->Free();
-
-		Cuda::Allocate(this->RootNode, Nodes.size());
-		Cuda::MemCopyHostToDevice(&Nodes[0], this->RootNode, Nodes.size()); 
-	}
-
-	HOST void Free()
-	{
-		Cuda::Free(this->RootNode);
-	}
-
-	int				MaxDepth;
-	OctreeNode*		RootNode;
-	float			Sigma;
-};
-
-}
\ No newline at end of file
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "defines.h"
+#include "enums.h"
+#include "buffer1d.h"
+#include "macrocellgrid.h"
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define OCTREE_MAX_LEVELS		16
+#define OCTREE_CHUNK_SIZE		4096
+
+/*! \class Octree
+ * \brief Implicit min/max octree over the voxels, the leaves are the cells of a macrocell grid and every level halves the resolution of the level below it until a single root node remains. Nodes are addressed by level and cell index, so the tree can be traversed without a stack
+ */
+class EXPOSURE_RENDER_DLL Octree
+{
+public:
+	/*! Default constructor */
+	HOST Octree() :
+		MinIntensity("Octree Minimum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxIntensity("Octree Maximum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxOpacity("Octree Maximum Opacity", Enums::Device, Enums::NearestNeighbour, Enums::Clamp),
+		HostMaxOpacity("Host Octree Maximum Opacity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		NoLevels(0),
+		Classified(false),
+		MinP(0.0f),
+		InvCellSize(0.0f),
+		CellSize(0.0f)
+	{
+	}
+
+	/*! Assignment operator
+		@param[in] Other Octree to copy
+		@return Copied octree
+	*/
+	HOST Octree& operator = (const Octree& Other)
+	{
+		this->MinIntensity	= Other.MinIntensity;
+		this->MaxIntensity	= Other.MaxIntensity;
+		this->MaxOpacity	= Other.MaxOpacity;
+		this->HostMaxOpacity	= Other.HostMaxOpacity;
+		this->NoLevels		= Other.NoLevels;
+		this->Classified	= Other.Classified;
+		this->MinP			= Other.MinP;
+		this->InvCellSize	= Other.InvCellSize;
+		this->CellSize		= Other.CellSize;
+
+		for (int i = 0; i < OCTREE_MAX_LEVELS; i++)
+		{
+			this->LevelResolution[i]	= Other.LevelResolution[i];
+			this->LevelOffset[i]		= Other.LevelOffset[i];
+		}
+
+		return *this;
+	}
+
+	/*! Builds the tree bottom up from the intensity ranges of \a Macrocells
+		@param[in] Macrocells Macrocell grid which provides the leaves
+	*/
+	HOST void Build(const MacrocellGrid& Macrocells)
+	{
+		this->MinP			= Macrocells.MinP;
+		this->InvCellSize	= Macrocells.InvCellSize;
+		this->CellSize		= Macrocells.CellSize;
+
+		const Vec3i LeafResolution = Macrocells.MinIntensity.GetResolution();
+
+		if (this->NoLevels > 0 && this->LevelResolution[0] == LeafResolution && this->VoxelsTimeStamp == Macrocells.VoxelsTimeStamp)
+			return;
+
+		int NoNodes = 0;
+
+		this->NoLevels = 0;
+
+		Vec3i Resolution = LeafResolution;
+
+		while (this->NoLevels < OCTREE_MAX_LEVELS)
+		{
+			this->LevelResolution[this->NoLevels]	= Resolution;
+			this->LevelOffset[this->NoLevels]		= NoNodes;
+
+			NoNodes += Resolution.CumulativeProduct();
+
+			this->NoLevels++;
+
+			if (Resolution[0] <= 1 && Resolution[1] <= 1 && Resolution[2] <= 1)
+				break;
+
+			for (int i = 0; i < 3; i++)
+				Resolution[i] = (Resolution[i] + 1) / 2;
+		}
+
+		this->MinIntensity.Resize(Vec<int, 1>(NoNodes));
+		this->MaxIntensity.Resize(Vec<int, 1>(NoNodes));
+
+		unsigned short* pMin = this->MinIntensity.GetData();
+		unsigned short* pMax = this->MaxIntensity.GetData();
+
+		memcpy(pMin, Macrocells.MinIntensity.GetData(), LeafResolution.CumulativeProduct() * sizeof(unsigned short));
+		memcpy(pMax, Macrocells.MaxIntensity.GetData(), LeafResolution.CumulativeProduct() * sizeof(unsigned short));
+
+		for (int Level = 1; Level < this->NoLevels; Level++)
+		{
+			const Vec3i& ChildResolution = this->LevelResolution[Level - 1];
+
+			for (int Z = 0; Z < this->LevelResolution[Level][2]; Z++)
+			{
+				for (int Y = 0; Y < this->LevelResolution[Level][1]; Y++)
+				{
+					for (int X = 0; X < this->LevelResolution[Level][0]; X++)
+					{
+						const int Node = this->GetNode(Level, X, Y, Z);
+
+						pMin[Node] = USHRT_MAX;
+						pMax[Node] = 0;
+
+						for (int z = 2 * Z; z < min(2 * Z + 2, ChildResolution[2]); z++)
+						{
+							for (int y = 2 * Y; y < min(2 * Y + 2, ChildResolution[1]); y++)
+							{
+								for (int x = 2 * X; x < min(2 * X + 2, ChildResolution[0]); x++)
+								{
+									const int Child = this->GetNode(Level - 1, x, y, z);
+
+									pMin[Node] = min(pMin[Node], pMin[Child]);
+									pMax[Node] = max(pMax[Node], pMax[Child]);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Until the tree is classified no node is considered transparent
+		std::vector<float> MaxOpacity(NoNodes, FLT_MAX);
+
+		this->MaxOpacity.Set(Enums::Host, Vec<int, 1>(NoNodes), &MaxOpacity[0]);
+		this->HostMaxOpacity.Set(Enums::Host, Vec<int, 1>(NoNodes), &MaxOpacity[0]);
+
+		this->VoxelsTimeStamp	= Macrocells.VoxelsTimeStamp;
+		this->Classified		= false;
+	}
+
+	/*! Computes the maximum opacity of every node, the leaves take the maximum opacity of their macrocell and inner nodes the maximum of their children. Once the tree is classified, only the nodes whose intensity range overlaps the intensities at which the opacity of \a Macrocells changed are updated
+		@param[in] Macrocells Classified macrocell grid
+	*/
+	HOST void Classify(const MacrocellGrid& Macrocells)
+	{
+		if (this->NoLevels <= 0)
+			return;
+
+		const Vec2i ChangedRange = this->Classified ? Macrocells.GetChangedRange() : Vec2i(0, USHRT_MAX);
+
+		if (ChangedRange[0] > ChangedRange[1])
+			return;
+
+		std::vector<bool> ChangedChunks((this->HostMaxOpacity.GetNoElements() + OCTREE_CHUNK_SIZE - 1) / OCTREE_CHUNK_SIZE, false);
+
+		this->Classify(Macrocells, ChangedRange, this->NoLevels - 1, 0, 0, 0, ChangedChunks);
+
+		float* pMaxOpacity = this->HostMaxOpacity.GetData();
+
+		// Only the chunks of nodes whose maximum opacity changed are copied to the device
+		for (int Chunk = 0; Chunk < (int)ChangedChunks.size(); Chunk++)
+		{
+			if (!ChangedChunks[Chunk])
+				continue;
+
+			const int First = Chunk * OCTREE_CHUNK_SIZE;
+
+#if defined(__CUDACC__) || defined(ER_CPU)
+			Cuda::MemCopyHostToDevice(pMaxOpacity + First, this->MaxOpacity.GetData() + First, min(OCTREE_CHUNK_SIZE, this->HostMaxOpacity.GetNoElements() - First));
+#endif
+		}
+
+		this->MaxOpacity.Modified();
+
+		this->Classified = true;
+	}
+
+	/*! Advances \a T over transparent space, at every step the ray jumps over the largest transparent node which contains the current sample, which is found by ascending from the leaf. The new \a T stays on the sampling lattice T + k * \a StepSize
+		@param[in] O Ray origin
+		@param[in] D Ray direction
+		@param[in,out] T Parametric distance of the next sample
+		@param[in] StepSize Step size
+		@param[in] MaxT Maximum parametric distance
+		@return Whether \a T was advanced
+	*/
+	HOST_DEVICE bool Skip(const Vec3f& O, const Vec3f& D, float& T, const float& StepSize, const float& MaxT) const
+	{
+		if (this->NoLevels <= 0)
+			return false;
+
+		const float* pMaxOpacity = this->MaxOpacity.GetData();
+
+		float NewT = T;
+
+		while (NewT < MaxT)
+		{
+			int Cell[3];
+
+			this->GetCell(O + D * NewT, Cell);
+
+			if (pMaxOpacity[this->GetNode(0, Cell[0], Cell[1], Cell[2])] > 0.0f)
+				break;
+
+			int Level = 0;
+
+			while (Level + 1 < this->NoLevels && pMaxOpacity[this->GetNode(Level + 1, Cell[0] >> (Level + 1), Cell[1] >> (Level + 1), Cell[2] >> (Level + 1))] <= 0.0f)
+				Level++;
+
+			// Exit distance of the transparent node
+			float ExitT = FLT_MAX;
+
+			for (int i = 0; i < 3; i++)
+			{
+				const float NodeSize	= this->CellSize[i] * (float)(1 << Level);
+				const float NodeMinP	= this->MinP[i] + (float)(Cell[i] >> Level) * NodeSize;
+
+				if (D[i] > 0.0f)
+					ExitT = min(ExitT, (NodeMinP + NodeSize - O[i]) / D[i]);
+				else if (D[i] < 0.0f)
+					ExitT = min(ExitT, (NodeMinP - O[i]) / D[i]);
+			}
+
+			const float NextT = T + ceilf((ExitT - T) / StepSize) * StepSize;
+
+			// The sample at NewT is transparent, so at least move on to the next sample
+			NewT = NextT > NewT ? NextT : NewT + StepSize;
+		}
+
+		if (NewT == T)
+			return false;
+
+		T = NewT;
+
+		return true;
+	}
+
+	/*! Gets an upper bound of the opacity along the segment from \a P0 to \a P1, which is the maximum opacity of the smallest node that encloses the segment
+		@param[in] P0 Start of the segment
+		@param[in] P1 End of the segment
+		@return Upper bound of the opacity
+	*/
+	HOST_DEVICE float GetMaxOpacity(const Vec3f& P0, const Vec3f& P1) const
+	{
+		if (this->NoLevels <= 0)
+			return FLT_MAX;
+
+		int Cell0[3], Cell1[3];
+
+		this->GetCell(P0, Cell0);
+		this->GetCell(P1, Cell1);
+
+		int Level = 0;
+
+		while (Level + 1 < this->NoLevels && ((Cell0[0] >> Level) != (Cell1[0] >> Level) || (Cell0[1] >> Level) != (Cell1[1] >> Level) || (Cell0[2] >> Level) != (Cell1[2] >> Level)))
+			Level++;
+
+		return this->MaxOpacity.GetData()[this->GetNode(Level, Cell0[0] >> Level, Cell0[1] >> Level, Cell0[2] >> Level)];
+	}
+
+	GET_MACRO(HOST, Classified, bool)
+
+protected:
+	/*! Updates the maximum opacity of a node and, depth first, of its descendants whose intensity range overlaps \a ChangedRange. The range of a node encloses the ranges of its children, so the descendants of a node outside \a ChangedRange are skipped altogether
+		@param[in] Macrocells Classified macrocell grid
+		@param[in] ChangedRange Intensities at which the opacity changed
+		@param[in] Level Level of the node
+		@param[in] X X cell index within the level
+		@param[in] Y Y cell index within the level
+		@param[in] Z Z cell index within the level
+		@param[in,out] ChangedChunks Flags the chunks of nodes whose maximum opacity changed
+	*/
+	HOST void Classify(const MacrocellGrid& Macrocells, const Vec2i& ChangedRange, const int& Level, const int& X, const int& Y, const int& Z, std::vector<bool>& ChangedChunks)
+	{
+		const int Node = this->GetNode(Level, X, Y, Z);
+
+		if (this->MaxIntensity.GetData()[Node] < ChangedRange[0] || this->MinIntensity.GetData()[Node] > ChangedRange[1])
+			return;
+
+		float* pMaxOpacity = this->HostMaxOpacity.GetData();
+
+		float MaxOpacity = 0.0f;
+
+		if (Level == 0)
+		{
+			MaxOpacity = Macrocells.HostMaxOpacity.GetData()[Node];
+		}
+		else
+		{
+			const Vec3i& ChildResolution = this->LevelResolution[Level - 1];
+
+			for (int z = 2 * Z; z < min(2 * Z + 2, ChildResolution[2]); z++)
+			{
+				for (int y = 2 * Y; y < min(2 * Y + 2, ChildResolution[1]); y++)
+				{
+					for (int x = 2 * X; x < min(2 * X + 2, ChildResolution[0]); x++)
+					{
+						this->Classify(Macrocells, ChangedRange, Level - 1, x, y, z, ChangedChunks);
+
+						MaxOpacity = max(MaxOpacity, pMaxOpacity[this->GetNode(Level - 1, x, y, z)]);
+					}
+				}
+			}
+		}
+
+		if (MaxOpacity == pMaxOpacity[Node])
+			return;
+
+		pMaxOpacity[Node] = MaxOpacity;
+
+		ChangedChunks[Node / OCTREE_CHUNK_SIZE] = true;
+	}
+
+	/*! Gets the leaf which contains \a P, positions outside the tree are clamped to the nearest leaf
+		@param[in] P Position in world space
+		@param[out] Cell Leaf cell index
+	*/
+	HOST_DEVICE void GetCell(const Vec3f& P, int (&Cell)[3]) const
+	{
+		for (int i = 0; i < 3; i++)
+			Cell[i] = Clamp((int)floorf((P[i] - this->MinP[i]) * this->InvCellSize[i]), 0, this->LevelResolution[0][i] - 1);
+	}
+
+	/*! Gets the index of a node
+		@param[in] Level Level of the node, zero for the leaves
+		@param[in] X X cell index within the level
+		@param[in] Y Y cell index within the level
+		@param[in] Z Z cell index within the level
+		@return Node index
+	*/
+	HOST_DEVICE int GetNode(const int& Level, const int& X, const int& Y, const int& Z) const
+	{
+		const Vec3i& Resolution = this->LevelResolution[Level];
+
+		return this->LevelOffset[Level] + (Z * Resolution[1] + Y) * Resolution[0] + X;
+	}
+
+	Buffer1D<unsigned short>	MinIntensity;							/*! Minimum intensity per node */
+	Buffer1D<unsigned short>	MaxIntensity;							/*! Maximum intensity per node */
+	Buffer1D<float>				MaxOpacity;								/*! Maximum opacity per node */
+	Buffer1D<float>				HostMaxOpacity;							/*! Host copy of the maximum opacity per node, which classification updates in place */
+	int							NoLevels;								/*! Number of levels */
+	Vec3i						LevelResolution[OCTREE_MAX_LEVELS];		/*! Number of nodes per axis in each level */
+	int							LevelOffset[OCTREE_MAX_LEVELS];			/*! Index of the first node in each level */
+	TimeStamp					VoxelsTimeStamp;						/*! Time stamp of the voxels the tree was built from */
+	bool						Classified;								/*! Whether the maximum opacities reflect an opacity transfer function */
+	Vec3f						MinP;									/*! Minimum corner of the tree in world space */
+	Vec3f						InvCellSize;							/*! Inverse leaf size in world space */
+	Vec3f						CellSize;								/*! Leaf size in world space */
+};
+
+}
@@ -0,0 +1,149 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer2d.h"
+#include "transferfunction1d.h"
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define PREINTEGRATION_SUPERSAMPLING	16
+#define PREINTEGRATION_OPACITY_SCALE	200.0f
+
+/*! \class PreIntegrationTable
+ * \brief Pre-integrated transfer function table for direct volume rendering. Entry (front, back) holds the premultiplied color and opacity of a ray segment of one step length whose intensity varies linearly from the front to the back intensity, so thin transfer function features are not missed when stepping coarsely
+ */
+class EXPOSURE_RENDER_DLL PreIntegrationTable
+{
+public:
+	/*! Default constructor */
+	HOST PreIntegrationTable() :
+		Table("Pre-Integration Table", Enums::Device, Enums::Linear, Enums::Clamp),
+		StepSize(0.0f),
+		MinIntensity(0.0f),
+		Scale(0.0f)
+	{
+	}
+
+	/*! Builds the table for the current opacity and diffuse transfer functions, the table spans the node range of both transfer functions since they are constant outside of it
+		@param[in] Opacity1D Opacity transfer function
+		@param[in] Diffuse1D Diffuse color transfer function
+		@param[in] StepSize Length of a ray segment
+	*/
+	HOST void Build(const ScalarTransferFunction1D& Opacity1D, const ColorTransferFunction1D& Diffuse1D, const float& StepSize)
+	{
+		const Vec2f OpacityRange	= Opacity1D.GetNodeRange();
+		const Vec2f DiffuseRange	= Diffuse1D.GetNodeRange();
+
+		const float Min		= min(OpacityRange[0], DiffuseRange[0]);
+		const float Max		= max(max(OpacityRange[1], DiffuseRange[1]), Min + 1.0f);
+
+		const int NoIntegralSamples = (PREINTEGRATION_RESOLUTION - 1) * PREINTEGRATION_SUPERSAMPLING + 1;
+
+		const float H = (Max - Min) / (float)(NoIntegralSamples - 1);
+
+		// Running integrals of the extinction and the extinction weighted color (trapezoidal rule)
+		vector<float> Extinction(NoIntegralSamples), IntegralExtinction(NoIntegralSamples);
+		vector<ColorXYZf> Color(NoIntegralSamples), IntegralColor(NoIntegralSamples);
+
+		for (int i = 0; i < NoIntegralSamples; i++)
+		{
+			const float Intensity = Min + (float)i * H;
+
+			Extinction[i]	= PREINTEGRATION_OPACITY_SCALE * Opacity1D.Evaluate(Intensity);
+			Color[i]		= Diffuse1D.Evaluate(Intensity) * Extinction[i];
+
+			if (i == 0)
+			{
+				IntegralExtinction[i]	= 0.0f;
+				IntegralColor[i]		= ColorXYZf::Black();
+			}
+			else
+			{
+				IntegralExtinction[i]	= IntegralExtinction[i - 1] + 0.5f * H * (Extinction[i - 1] + Extinction[i]);
+				IntegralColor[i]		= IntegralColor[i - 1] + 0.5f * H * (Color[i - 1] + Color[i]);
+			}
+		}
+
+		vector<ColorXYZAf> Entries(PREINTEGRATION_RESOLUTION * PREINTEGRATION_RESOLUTION);
+
+		for (int Back = 0; Back < PREINTEGRATION_RESOLUTION; Back++)
+		{
+			for (int Front = 0; Front < PREINTEGRATION_RESOLUTION; Front++)
+			{
+				const int F = Front * PREINTEGRATION_SUPERSAMPLING;
+				const int B = Back * PREINTEGRATION_SUPERSAMPLING;
+
+				float AverageExtinction = Extinction[F];
+				ColorXYZf AverageColor = Color[F];
+
+				if (F != B)
+				{
+					const float InvLength = 1.0f / ((float)(B - F) * H);
+
+					AverageExtinction	= (IntegralExtinction[B] - IntegralExtinction[F]) * InvLength;
+					AverageColor		= (IntegralColor[B] - IntegralColor[F]) * InvLength;
+				}
+
+				ColorXYZAf& Entry = Entries[Back * PREINTEGRATION_RESOLUTION + Front];
+
+				Entry = ColorXYZAf::Black();
+
+				if (AverageExtinction <= 0.0f)
+					continue;
+
+				// Opacity of the segment, the color neglects attenuation within the segment
+				const float Alpha = 1.0f - expf(-AverageExtinction * StepSize);
+
+				for (int c = 0; c < 3; c++)
+					Entry[c] = AverageColor[c] / AverageExtinction * Alpha;
+
+				Entry[3] = Alpha;
+			}
+		}
+
+		this->Table.Set(Enums::Host, Vec2i(PREINTEGRATION_RESOLUTION), &Entries[0]);
+
+		this->StepSize		= StepSize;
+		this->MinIntensity	= Min;
+		this->Scale			= (float)(PREINTEGRATION_RESOLUTION - 1) / (Max - Min);
+	}
+
+	/*! Looks up the premultiplied color and opacity of a ray segment
+		@param[in] FrontIntensity Intensity at the start of the segment
+		@param[in] BackIntensity Intensity at the end of the segment
+		@return Premultiplied color and opacity
+	*/
+	HOST_DEVICE ColorXYZAf Lookup(const float& FrontIntensity, const float& BackIntensity) const
+	{
+		return this->Table(Vec2f((FrontIntensity - this->MinIntensity) * this->Scale, (BackIntensity - this->MinIntensity) * this->Scale));
+	}
+
+	GET_MACRO(HOST_DEVICE, StepSize, float)
+
+protected:
+	Buffer2D<ColorXYZAf>	Table;				/*! Segment color and opacity, indexed by front and back intensity */
+	float					StepSize;			/*! Segment length the table was built for */
+	float					MinIntensity;		/*! Intensity of the first table entry */
+	float					Scale;				/*! Table entries per unit intensity */
+};
+
+}
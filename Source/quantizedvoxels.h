@@ -0,0 +1,296 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "buffer1d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "volumeproperty.h"
+
+#include <vector>
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+namespace ExposureRender
+{
+
+#define QUANTIZED_MAX_CODE		255
+#define QUANTIZED_NO_PROBES		8
+#define QUANTIZED_MAX_NO_PROBES	65536
+
+typedef BasicVoxelSampler<const unsigned char*> QuantizedVoxelSampler;
+
+/*! \class QuantizedVoxels
+ * \brief 8-bit copy of the voxels which halves the bandwidth of voxel fetches. The 256 codes are spread over an intensity window, the part of the histogram the transfer functions have nodes in, values outside the window are clamped to it. Codes are clamped before they are interpolated, so a sample near a clamped voxel can be off by more than half a code, GetMaxOpacityError accounts for this. Samples are mapped back to the 16-bit domain so the transfer functions are evaluated as usual
+ */
+class EXPOSURE_RENDER_DLL QuantizedVoxels
+{
+public:
+	/*! Default constructor */
+	HOST QuantizedVoxels() :
+		Resolution(),
+		Window(0.0f),
+		Range(0.0f),
+		Scale(0.0f),
+		Voxels("Device Quantized Voxels", Enums::Device),
+		Offsets("Device Quantized Voxel Offsets", Enums::Device)
+	{
+	}
+
+	/*! Gets the intensity window the codes are spread over, the nodes of all transfer functions of \a VolumeProperty clipped to the occupied part of \a Histogram
+		@param[in] Histogram Intensity histogram of the volume
+		@param[in] VolumeProperty Volume property with the transfer functions
+		@return Window, an empty window when the histogram is empty
+	*/
+	HOST static Vec2f GetWindow(const Buffer1D<unsigned long long>& Histogram, const VolumeProperty& VolumeProperty)
+	{
+		const Vec2f NodeRanges[] =
+		{
+			VolumeProperty.GetOpacity1D().GetNodeRange(),
+			VolumeProperty.GetDiffuse1D().GetNodeRange(),
+			VolumeProperty.GetSpecular1D().GetNodeRange(),
+			VolumeProperty.GetGlossiness1D().GetNodeRange(),
+			VolumeProperty.GetIndexOfReflection1D().GetNodeRange(),
+			VolumeProperty.GetEmission1D().GetNodeRange()
+		};
+
+		Vec2f Window(FLT_MAX, -FLT_MAX);
+
+		const int NoNodeRanges = (int)(sizeof(NodeRanges) / sizeof(NodeRanges[0]));
+
+		for (int i = 0; i < NoNodeRanges; i++)
+		{
+			Window[0] = min(Window[0], NodeRanges[i][0]);
+			Window[1] = max(Window[1], NodeRanges[i][1]);
+		}
+
+		int Min = 0, Max = Histogram.GetNoElements() - 1;
+
+		while (Min <= Max && Histogram[Min] == 0)
+			Min++;
+
+		while (Max >= Min && Histogram[Max] == 0)
+			Max--;
+
+		if (Min > Max)
+			return Vec2f(0.0f);
+
+		Window[0] = Clamp(Window[0], (float)Min, (float)Max);
+		Window[1] = Clamp(Window[1], Window[0], (float)Max);
+
+		return Window;
+	}
+
+	/*! Quantizes the voxels \a Sampler reads to \a Window
+		@param[in] Sampler Sampler of the 16-bit voxels, in any voxel layout
+		@param[in] Resolution Resolution of the voxels
+		@param[in] Window Intensity window
+	*/
+	template<class T>
+	HOST void Set(const BasicVoxelSampler<T>& Sampler, const Vec3i& Resolution, const Vec2f& Window)
+	{
+		this->Resolution	= Resolution;
+		this->Window		= Window;
+		this->Scale			= (Window[1] - Window[0]) / (float)QUANTIZED_MAX_CODE;
+
+		const float InvScale = this->Scale > 0.0f ? 1.0f / this->Scale : 0.0f;
+
+		Buffer1D<int> Offsets("Host Quantized Voxel Offsets", Enums::Host);
+
+		Offsets.Resize(Vec<int, 1>(Resolution[0] + Resolution[1] + Resolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(Enums::Scanline, Resolution, StorageResolution, Offsets.GetData());
+
+		Buffer1D<unsigned char> Voxels("Host Quantized Voxels", Enums::Host);
+
+		Voxels.Resize(Vec<int, 1>(Resolution.CumulativeProduct()));
+
+		std::vector<Vec2f> SliceRanges(Resolution[2], Vec2f(FLT_MAX, -FLT_MAX));
+
+		const auto QuantizeSlice = [&](int Z)
+		{
+			unsigned char* pSlice = Voxels.GetData() + Z * Resolution[0] * Resolution[1];
+
+			Vec2f& SliceRange = SliceRanges[Z];
+
+			for (int Y = 0; Y < Resolution[1]; Y++)
+			{
+				for (int X = 0; X < Resolution[0]; X++)
+				{
+					const int XYZ[3] = { X, Y, Z };
+
+					const float Intensity = (float)Sampler.GetVoxel(XYZ);
+
+					SliceRange[0] = min(SliceRange[0], Intensity);
+					SliceRange[1] = max(SliceRange[1], Intensity);
+
+					const float Code = (Intensity - Window[0]) * InvScale + 0.5f;
+
+					pSlice[Y * Resolution[0] + X] = (unsigned char)Clamp(Code, 0.0f, (float)QUANTIZED_MAX_CODE);
+				}
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(Resolution[2], QuantizeSlice);
+#else
+		for (int Z = 0; Z < Resolution[2]; Z++)
+			QuantizeSlice(Z);
+#endif
+
+		this->Range = Vec2f(FLT_MAX, -FLT_MAX);
+
+		for (int Z = 0; Z < Resolution[2]; Z++)
+		{
+			this->Range[0] = min(this->Range[0], SliceRanges[Z][0]);
+			this->Range[1] = max(this->Range[1], SliceRanges[Z][1]);
+		}
+
+		this->Voxels.Set(Enums::Host, Voxels.GetResolution(), Voxels.GetData());
+		this->Offsets.Set(Enums::Host, Offsets.GetResolution(), Offsets.GetData());
+	}
+
+	/*! Releases the quantized voxels */
+	HOST void Free()
+	{
+		this->Resolution	= Vec3i();
+		this->Window		= Vec2f(0.0f);
+		this->Range			= Vec2f(0.0f);
+		this->Scale			= 0.0f;
+
+		this->Voxels.Free();
+		this->Offsets.Free();
+	}
+
+	/*! Bounds the opacity error of sampling the quantized voxels instead of the 16-bit voxels. Rounding puts a code at most half a code off its voxel, clamping puts it up to the distance between the window and the voxel range off, and interpolation keeps a sample within the worst of these offsets. The error is therefore the largest change of \a Opacity over any interval of that extent around an intensity in the window, probed at QUANTIZED_NO_PROBES points per code and at most QUANTIZED_MAX_NO_PROBES points in total
+		@param[in] Opacity Opacity transfer function
+		@return Largest opacity error
+	*/
+	HOST float GetMaxOpacityError(const ScalarTransferFunction1D& Opacity) const
+	{
+		const float Below	= max(this->Window[0] - this->Range[0], 0.0f) + 0.5f * this->Scale;
+		const float Above	= max(this->Range[1] - this->Window[1], 0.0f) + 0.5f * this->Scale;
+		const float Extent	= Below + Above;
+		const float Span	= this->Window[1] - this->Window[0] + Extent;
+
+		if (Extent <= 0.0f)
+			return 0.0f;
+
+		const float Step = max(this->Scale / (float)QUANTIZED_NO_PROBES, Span / (float)(QUANTIZED_MAX_NO_PROBES - 1));
+
+		const int NoProbes	= (int)ceilf(Span / Step) + 1;
+		const int Width		= min((int)ceilf(Extent / Step) + 1, NoProbes);
+
+		std::vector<float> Values(NoProbes);
+
+		for (int i = 0; i < NoProbes; i++)
+			Values[i] = Opacity.Evaluate(this->Window[0] - Below + (float)i * Step);
+
+		// Sliding window minimum and maximum over Width probes, from running extremes within blocks of Width probes
+		std::vector<Vec2f> Prefix(NoProbes), Suffix(NoProbes);
+
+		for (int i = 0; i < NoProbes; i++)
+			Prefix[i] = i % Width == 0 ? Vec2f(Values[i]) : Vec2f(min(Prefix[i - 1][0], Values[i]), max(Prefix[i - 1][1], Values[i]));
+
+		for (int i = NoProbes - 1; i >= 0; i--)
+			Suffix[i] = (i + 1) % Width == 0 || i == NoProbes - 1 ? Vec2f(Values[i]) : Vec2f(min(Suffix[i + 1][0], Values[i]), max(Suffix[i + 1][1], Values[i]));
+
+		float MaxError = 0.0f;
+
+		for (int i = 0; i + Width <= NoProbes; i++)
+		{
+			const Vec2f& First	= Suffix[i];
+			const Vec2f& Last	= Prefix[i + Width - 1];
+
+			MaxError = max(MaxError, max(First[1], Last[1]) - min(First[0], Last[0]));
+		}
+
+		return MaxError;
+	}
+
+	/*! Gets whether voxels have been quantized
+		@return Whether voxels can be sampled
+	*/
+	HOST_DEVICE bool GetEnabled() const
+	{
+		return this->Voxels.GetNoElements() > 0;
+	}
+
+	/*! Gets a fixed point trilinear sampler which returns codes
+		@return Voxel sampler
+	*/
+	HOST_DEVICE QuantizedVoxelSampler GetSampler() const
+	{
+		return QuantizedVoxelSampler(this->Voxels.GetData(), this->Offsets.GetData(), this->Resolution);
+	}
+
+	/*! Fetches the voxels at \a UVW and maps the code back to the 16-bit domain
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@param[in] Nearest Whether to fetch the nearest voxel instead of interpolating
+		@return Intensity at \a UVW
+	*/
+	HOST_DEVICE float Fetch(const Vec3f& UVW, const bool& Nearest) const
+	{
+		const QuantizedVoxelSampler Sampler = this->GetSampler();
+
+		return this->Window[0] + (Nearest ? (float)Sampler.Nearest(UVW) : Sampler(UVW)) * this->Scale;
+	}
+
+	GET_MACRO(HOST, Window, Vec2f)
+
+protected:
+	Vec3i							Resolution;			/*! Resolution of the volume */
+	Vec2f							Window;				/*! Intensity window of the codes */
+	Vec2f							Range;				/*! Intensity range of the voxels */
+	float							Scale;				/*! Intensity step per code */
+	Buffer1D<unsigned char>			Voxels;				/*! Scanline ordered codes */
+	Buffer1D<int>					Offsets;			/*! Offset tables of the scanline voxel layout */
+};
+
+/*! Sampler visitor which quantizes the voxels of the sampler */
+struct QuantizeVisitor
+{
+	typedef void Result;
+
+	/*! Constructor
+		@param[in] Quantized Quantized voxels to set
+		@param[in] Resolution Resolution of the volume
+		@param[in] Window Intensity window, see QuantizedVoxels::GetWindow
+	*/
+	HOST QuantizeVisitor(QuantizedVoxels& Quantized, const Vec3i& Resolution, const Vec2f& Window) :
+		Quantized(Quantized),
+		Resolution(Resolution),
+		Window(Window)
+	{
+	}
+
+	template<class T>
+	HOST void operator()(const BasicVoxelSampler<T>& Sampler) const
+	{
+		this->Quantized.Set(Sampler, this->Resolution, this->Window);
+	}
+
+	QuantizedVoxels&	Quantized;			/*! Quantized voxels to set */
+	Vec3i				Resolution;			/*! Resolution of the volume */
+	Vec2f				Window;				/*! Intensity window */
+};
+
+}
@@ -1,100 +1,282 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "geometry.h"
-#include "volume.h"
-#include "transferfunction.h"
-
-namespace ExposureRender
-{
-
-/*! Intersects the volume with a ray
-	@param[in] R Ray
-	@param[in] RNG Random number generator
-	@param[out] Int Intersection result
-	@param[in] VolumeID ID of the volume
-*/
-DEVICE void IntersectVolume(Ray R, RNG& RNG, Intersection& Int, const int& VolumeID = 0)
-{
-	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
-
-	if (!Volume.BoundingBox.Intersect(R, R.MinT, R.MaxT))
-		return;
-
-	const float S	= -log(RNG.Get1()) / gDensityScale;
-	float Sum		= 0.0f;
-
-	R.MinT += RNG.Get1() * gStepFactorPrimary;
-
-	while (Sum < S)
-	{
-		if (R.MinT + gStepFactorPrimary >= R.MaxT)
-			return;
-		
-		Int.SetP(R(R.MinT));
-		Int.SetIntensity(Volume(Int.GetP(), VolumeID));
-
-		Sum				+= gDensityScale * gpTracer->VolumeProperty.GetOpacity(Int.GetIntensity()) * gStepFactorPrimary;
-		R.MinT			+= gStepFactorPrimary;
-	}
-
-	Int.SetValid(true);
-	Int.SetWo(-R.D);
-	Int.SetN(Volume.NormalizedGradient(Int.GetP(), Enums::CentralDifferences));
-	Int.SetT(R.MinT);
-	Int.SetScatterType(Enums::Volume);
-}
-
-/*! Whether a scattering event happens in the volume along the ray
-	@param[in] R Ray
-	@param[in] RNG Random number generator
-	@param[in] VolumeID ID of the volume
-	@return Whether an scattering event occurs in the ray's parametric range
-*/
-DEVICE bool IntersectsVolume(Ray R, RNG& RNG, const int& VolumeID = 0)
-{
-	if (!gpTracer->VolumeProperty.GetShadows())
-		return false;
-
-	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
-
-	float MaxT = 0.0f;
-
-	if (!Volume.BoundingBox.Intersect(R, R.MinT, MaxT))
-		return false;
-
-	R.MaxT = min(R.MaxT, MaxT);
-
-	const float S	= -log(RNG.Get1()) / gDensityScale;
-	float Sum		= 0.0f;
-	
-	R.MinT += RNG.Get1() * gStepFactorShadow;
-
-	while (Sum < S)
-	{
-		if (R.MinT > R.MaxT)
-			return false;
-
-		Sum		+= gDensityScale * gpTracer->VolumeProperty.GetOpacity(Volume(R(R.MinT), VolumeID)) * gStepFactorShadow;
-		R.MinT	+= gStepFactorShadow;
-	}
-
-	return true;
-}
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "geometry.h"
+#include "volume.h"
+#include "transferfunction.h"
+
+namespace ExposureRender
+{
+
+/*! Gets the extinction coefficient at \a Intensity, which matches the ray marcher (it accumulates gDensityScale * opacity * step until it exceeds -log(U) / gDensityScale)
+	@param[in] Opacity Opacity at the intensity
+	@return Extinction coefficient
+*/
+DEVICE float GetExtinction(const float& Opacity)
+{
+	return gDensityScale * gDensityScale * Opacity;
+}
+
+/*! Gets the intensity at \a P from the pyramid level that matches the footprint of the sample, which is the larger of \a StepSize and the footprint of a pixel at the distance of \a P to the camera. Full resolution samples come from the quantized voxels while the tracer samples those
+	@param[in] Volume Volume
+	@param[in] P Position
+	@param[in] StepSize Distance between samples
+	@param[in] LevelOfDetail Scale of the footprint, zero samples the full resolution
+	@param[in] VolumeID ID of the volume
+	@return Intensity at \a P
+*/
+DEVICE unsigned short GetIntensity(Volume& Volume, const Vec3f& P, const float& StepSize, const float& LevelOfDetail, const int& VolumeID = 0)
+{
+	if (LevelOfDetail <= 0.0f)
+		return gpTracer->QuantizedSampling ? Volume.GetIntensity(P, 0.0f, VolumeID, true) : Volume(P, VolumeID);
+
+	const float Footprint = max(StepSize, gpTracer->Camera.GetPixelSpread() * Length(P, gpTracer->Camera.GetPos()));
+
+	return Volume.GetIntensity(P, LevelOfDetail * Footprint, VolumeID, gpTracer->QuantizedSampling);
+}
+
+/*! Gets the opacity at \a P, from the classified opacities while the tracer samples those and otherwise from the opacity transfer function at the intensity at \a P (see GetIntensity). Classified opacities are always sampled at full resolution
+	@param[in] Volume Volume
+	@param[in] P Position
+	@param[in] StepSize Distance between samples
+	@param[in] LevelOfDetail Scale of the footprint, zero samples the full resolution
+	@param[in] VolumeID ID of the volume
+	@return Opacity at \a P
+*/
+DEVICE float GetOpacity(Volume& Volume, const Vec3f& P, const float& StepSize, const float& LevelOfDetail, const int& VolumeID = 0)
+{
+#ifdef ER_CPU
+	if (gpTracer->ClassifiedSampling)
+		return Volume.GetClassifiedOpacity(P);
+#endif
+
+	return gpTracer->VolumeProperty.GetOpacity(GetIntensity(Volume, P, StepSize, LevelOfDetail, VolumeID));
+}
+
+/*! Advances \a T to the next tentative collision of a ray with the majorant of the macrocells, the majorant is piecewise constant per cell and free paths restart at cell boundaries
+	@param[in,out] Traversal Walk of the ray through the macrocells
+	@param[in,out] T Parametric distance of the tentative collision
+	@param[in,out] T1 Parametric distance at which the ray leaves the current cell
+	@param[in,out] Majorant Extinction majorant of the current cell
+	@param[in] RNG Random number generator
+	@return Whether a tentative collision occurs before the ray leaves the volume
+*/
+DEVICE bool SampleTentativeCollision(MacrocellTraversal& Traversal, float& T, float& T1, float& Majorant, RNG& RNG)
+{
+	while (true)
+	{
+		if (Majorant > 0.0f)
+		{
+			T -= log(RNG.Get1()) / Majorant;
+
+			if (T < T1)
+				return true;
+		}
+
+		float T0 = 0.0f, MaxOpacity = 0.0f;
+
+		if (!Traversal.Next(T0, T1, MaxOpacity))
+			return false;
+
+		T			= T0;
+		Majorant	= GetExtinction(MaxOpacity);
+	}
+}
+
+/*! Samples a scattering event along a ray with delta tracking against the macrocell majorants
+	@param[in] Volume Volume
+	@param[in] R Ray, clipped to the volume
+	@param[in] RNG Random number generator
+	@param[out] Int Receives the position and intensity of the scattering event
+	@param[in] VolumeID ID of the volume
+	@return Whether a scattering event occurs
+*/
+DEVICE bool DeltaTrack(Volume& Volume, const Ray& R, RNG& RNG, Intersection& Int, const int& VolumeID = 0)
+{
+	MacrocellTraversal Traversal(Volume.Macrocells, R.O, R.D, R.MinT, R.MaxT);
+
+	float T = R.MinT, T1 = R.MinT, Majorant = 0.0f;
+
+	while (SampleTentativeCollision(Traversal, T, T1, Majorant, RNG))
+	{
+		Int.SetP(R(T));
+
+		if (RNG.Get1() * Majorant < GetExtinction(GetOpacity(Volume, Int.GetP(), gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary(), VolumeID)))
+		{
+			Int.SetT(T);
+			Int.SetIntensity(GetIntensity(Volume, Int.GetP(), gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary(), VolumeID));
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*! Intersects the volume with a ray
+	@param[in] R Ray
+	@param[in] RNG Random number generator
+	@param[out] Int Intersection result
+	@param[in] VolumeID ID of the volume
+*/
+DEVICE void IntersectVolume(Ray R, RNG& RNG, Intersection& Int, const int& VolumeID = 0)
+{
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	if (!Volume.BoundingBox.Intersect(R, R.MinT, R.MaxT))
+		return;
+
+	if (gpTracer->VolumeProperty.GetFreePathSampling() == Enums::DeltaTracking)
+	{
+		if (!DeltaTrack(Volume, R, RNG, Int, VolumeID))
+			return;
+	}
+	else
+	{
+		const float S	= -log(RNG.Get1()) / gDensityScale;
+		float Sum		= 0.0f;
+
+		R.MinT += RNG.Get1() * gStepFactorPrimary;
+
+		while (Sum < S)
+		{
+			Volume.SkipEmptySpace(R.O, R.D, R.MinT, gStepFactorPrimary, R.MaxT);
+
+			if (R.MinT + gStepFactorPrimary >= R.MaxT)
+				return;
+			
+			Int.SetP(R(R.MinT));
+
+			Sum				+= gDensityScale * GetOpacity(Volume, Int.GetP(), gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary(), VolumeID) * gStepFactorPrimary;
+			R.MinT			+= gStepFactorPrimary;
+		}
+
+		Int.SetT(R.MinT);
+		Int.SetIntensity(GetIntensity(Volume, Int.GetP(), gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary(), VolumeID));
+	}
+
+	Int.SetValid(true);
+	Int.SetWo(-R.D);
+	Int.SetN(Volume.NormalizedGradient(Int.GetP(), Enums::CentralDifferences));
+	Int.SetScatterType(Enums::Volume);
+}
+
+/*! Whether a scattering event happens in the volume along the ray
+	@param[in] R Ray
+	@param[in] RNG Random number generator
+	@param[in] VolumeID ID of the volume
+	@return Whether an scattering event occurs in the ray's parametric range
+*/
+DEVICE bool IntersectsVolume(Ray R, RNG& RNG, const int& VolumeID = 0)
+{
+	if (!gpTracer->VolumeProperty.GetShadows())
+		return false;
+
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	float MaxT = 0.0f;
+
+	if (!Volume.BoundingBox.Intersect(R, R.MinT, MaxT))
+		return false;
+
+	R.MaxT = min(R.MaxT, MaxT);
+
+	const float S	= -log(RNG.Get1()) / gDensityScale;
+	float Sum		= 0.0f;
+	
+	R.MinT += RNG.Get1() * gStepFactorShadow;
+
+	// The ray can not be occluded if an upper bound of the optical thickness stays below S
+	if (gDensityScale * Volume.GetMaxOpacity(R(R.MinT), R(R.MaxT)) * (R.MaxT - R.MinT + gStepFactorShadow) < S)
+		return false;
+
+	while (Sum < S)
+	{
+		Volume.SkipEmptySpace(R.O, R.D, R.MinT, gStepFactorShadow, R.MaxT);
+
+		if (R.MinT > R.MaxT)
+			return false;
+
+		Sum		+= gDensityScale * GetOpacity(Volume, R(R.MinT), gStepFactorShadow, gpTracer->VolumeProperty.GetLevelOfDetailShadow(), VolumeID) * gStepFactorShadow;
+		R.MinT	+= gStepFactorShadow;
+	}
+
+	return true;
+}
+
+/*! Applies one step of ratio tracking, transmittance estimates which become small are terminated with Russian roulette
+	@param[in,out] Transmittance Transmittance estimate
+	@param[in] Extinction Extinction at the tentative collision
+	@param[in] Majorant Extinction majorant at the tentative collision
+	@param[in] RNG Random number generator
+	@return Whether the estimate is still non-zero
+*/
+DEVICE bool RatioTrack(float& Transmittance, const float& Extinction, const float& Majorant, RNG& RNG)
+{
+	Transmittance *= 1.0f - Extinction / Majorant;
+
+	if (Transmittance < 0.1f)
+	{
+		if (RNG.Get1() < 0.5f)
+		{
+			Transmittance = 0.0f;
+			return false;
+		}
+
+		Transmittance *= 2.0f;
+	}
+
+	return Transmittance > 0.0f;
+}
+
+/*! Estimates the transmittance of the volume along a ray
+	@param[in] R Ray
+	@param[in] RNG Random number generator
+	@param[in] VolumeID ID of the volume
+	@return Transmittance, either zero or one for ray marching
+*/
+DEVICE float Transmittance(Ray R, RNG& RNG, const int& VolumeID = 0)
+{
+	if (!gpTracer->VolumeProperty.GetShadows())
+		return 1.0f;
+
+	if (gpTracer->VolumeProperty.GetFreePathSampling() != Enums::DeltaTracking)
+		return IntersectsVolume(R, RNG, VolumeID) ? 0.0f : 1.0f;
+
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	float MaxT = 0.0f;
+
+	if (!Volume.BoundingBox.Intersect(R, R.MinT, MaxT))
+		return 1.0f;
+
+	R.MaxT = min(R.MaxT, MaxT);
+
+	MacrocellTraversal Traversal(Volume.Macrocells, R.O, R.D, R.MinT, R.MaxT);
+
+	float Transmittance = 1.0f, T = R.MinT, T1 = R.MinT, Majorant = 0.0f;
+
+	while (SampleTentativeCollision(Traversal, T, T1, Majorant, RNG))
+	{
+		if (!RatioTrack(Transmittance, GetExtinction(GetOpacity(Volume, R(T), gStepFactorShadow, gpTracer->VolumeProperty.GetLevelOfDetailShadow(), VolumeID)), Majorant, RNG))
+			return 0.0f;
+	}
+
+	return Transmittance;
+}
+
+}
@@ -0,0 +1,549 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#ifdef ER_CPU
+
+#include "raymarching.h"
+#include "rng.h"
+
+#if defined(__AVX512F__)
+	#define RAY_PACKET_SIZE		16
+#else
+	#define RAY_PACKET_SIZE		8
+#endif
+
+#define RAY_PACKET_LANE(lane)	(1u << (lane))
+
+namespace ExposureRender
+{
+
+/*! \class RayPacket
+ * \brief Bundle of coherent rays which is marched through the volume in lock step, lanes are stored as a structure of arrays so that per lane loops map onto SIMD registers
+ */
+class RayPacket
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE RayPacket() :
+		Mask(0)
+	{
+	}
+
+	/*! Assigns a ray and its random number generator to \a Lane
+		@param[in] Lane Lane index
+		@param[in] R Ray
+		@param[in] RNG Random number generator of the ray
+	*/
+	HOST_DEVICE void Set(const int& Lane, const Ray& R, const RNG& RNG)
+	{
+		this->R[Lane]		= R;
+		this->RNG[Lane]		= RNG;
+		this->Mask			|= RAY_PACKET_LANE(Lane);
+	}
+
+	Ray				R[RAY_PACKET_SIZE];						/*! Lane rays */
+	RNG				RNG[RAY_PACKET_SIZE];					/*! Lane random number generators */
+	unsigned int	Mask;									/*! Lanes which hold a ray */
+	float			T[RAY_PACKET_SIZE];						/*! Parametric distance of the scattering event */
+	float			P[3][RAY_PACKET_SIZE];					/*! Position of the scattering event */
+	unsigned short	Intensity[RAY_PACKET_SIZE];				/*! Voxel intensity at the scattering event */
+};
+
+/*! Fetches voxel data for all lanes in \a Mask with the same semantics as Volume::Fetch, or as GetIntensity when level of detail sampling is enabled or the tracer samples the quantized voxels
+	@param[in] Volume Volume to sample
+	@param[in] P Lane positions in world space
+	@param[in] Mask Lanes to sample
+	@param[out] Intensity Lane voxel data
+	@param[in] StepSize Distance between samples
+	@param[in] LevelOfDetail Scale of the sample footprint, zero samples the full resolution
+*/
+HOST_DEVICE void FetchPacket(Volume& Volume, const float (&P)[3][RAY_PACKET_SIZE], const unsigned int& Mask, float (&Intensity)[RAY_PACKET_SIZE], const float& StepSize = 0.0f, const float& LevelOfDetail = 0.0f)
+{
+	if (LevelOfDetail > 0.0f || gpTracer->QuantizedSampling)
+	{
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (Mask & RAY_PACKET_LANE(l))
+				Intensity[l] = GetIntensity(Volume, Vec3f(P[0][l], P[1][l], P[2][l]), StepSize, LevelOfDetail);
+		}
+
+		return;
+	}
+
+	if (Volume.Voxels.GetFilterMode() != Enums::Linear || Volume.Bricks.GetEnabled() || Volume.Compressed.GetEnabled() || Volume.Sparse.GetEnabled() || Volume.VoxelType != Enums::UnsignedShort)
+	{
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (Mask & RAY_PACKET_LANE(l))
+				Intensity[l] = Volume.Fetch((Vec3f(P[0][l], P[1][l], P[2][l]) - Volume.BoundingBox.GetMinP()) * Volume.InvSize);
+		}
+
+		return;
+	}
+
+	const VoxelSampler Sampler = Volume.GetSampler();
+
+	const Vec3i& Resolution = Volume.Resolution;
+
+	int Base[3][RAY_PACKET_SIZE];
+	unsigned int Weight[3][RAY_PACKET_SIZE];
+
+	// Cell corners and fixed point weights for all lanes
+	for (int i = 0; i < 3; i++)
+	{
+		const float Scale	= Volume.InvSize[i] * (float)Resolution[i];
+		const float Offset	= -Volume.BoundingBox.GetMinP()[i] * Scale - 0.5f;
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+			Sampler.Locate(P[i][l] * Scale + Offset, i, Base[i][l], Weight[i][l]);
+	}
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		if (!(Mask & RAY_PACKET_LANE(l)))
+			continue;
+
+		const int XYZ[3] = { Base[0][l], Base[1][l], Base[2][l] };
+
+		Intensity[l] = (float)Sampler.Interpolate(XYZ, Weight[0][l], Weight[1][l], Weight[2][l]) * (1.0f / 65536.0f);
+	}
+}
+
+/*! Gets the opacity for all lanes in \a Mask with the same semantics as GetOpacity, from the classified opacities while the tracer samples those and otherwise from the intensities of FetchPacket
+	@param[in] Volume Volume to sample
+	@param[in] P Lane positions in world space
+	@param[in] Mask Lanes to sample
+	@param[out] Opacity Lane opacities
+	@param[out] Intensity Lane voxel data, zero while the tracer samples the classified opacities
+	@param[in] StepSize Distance between samples
+	@param[in] LevelOfDetail Scale of the sample footprint, zero samples the full resolution
+*/
+HOST_DEVICE void FetchOpacityPacket(Volume& Volume, const float (&P)[3][RAY_PACKET_SIZE], const unsigned int& Mask, float (&Opacity)[RAY_PACKET_SIZE], float (&Intensity)[RAY_PACKET_SIZE], const float& StepSize = 0.0f, const float& LevelOfDetail = 0.0f)
+{
+	if (gpTracer->ClassifiedSampling)
+	{
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			Intensity[l] = 0.0f;
+
+			if (Mask & RAY_PACKET_LANE(l))
+				Opacity[l] = Volume.GetClassifiedOpacity(Vec3f(P[0][l], P[1][l], P[2][l]));
+		}
+
+		return;
+	}
+
+	FetchPacket(Volume, P, Mask, Intensity, StepSize, LevelOfDetail);
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		if (Mask & RAY_PACKET_LANE(l))
+			Opacity[l] = gpTracer->VolumeProperty.GetOpacity((unsigned short)Intensity[l]);
+	}
+}
+
+/*! Fetches the intensity at the scattering events of the lanes in \a Hits, the marchers only fetch those themselves when the tracer evaluates the opacity transfer function
+	@param[in] Volume Volume to sample
+	@param[in,out] Packet Ray packet, receives the intensity of each scattering event
+	@param[in] Hits Lanes with a scattering event
+*/
+HOST_DEVICE void FetchScatteringIntensities(Volume& Volume, RayPacket& Packet, const unsigned int& Hits)
+{
+	if (!gpTracer->ClassifiedSampling || !Hits)
+		return;
+
+	float Intensity[RAY_PACKET_SIZE];
+
+	FetchPacket(Volume, Packet.P, Hits, Intensity, gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary());
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		if (Hits & RAY_PACKET_LANE(l))
+			Packet.Intensity[l] = (unsigned short)Intensity[l];
+	}
+}
+
+/*! Samples scattering events for all rays of \a Packet with delta tracking, equivalent to calling DeltaTrack for each lane
+	@param[in] Volume Volume
+	@param[in,out] Packet Ray packet, receives the position, distance and intensity of each scattering event
+	@param[in] VolumeID ID of the volume
+	@return Mask of lanes for which a scattering event occurred
+*/
+DEVICE unsigned int DeltaTrack(Volume& Volume, RayPacket& Packet, const int& VolumeID = 0)
+{
+	MacrocellTraversal Traversal[RAY_PACKET_SIZE];
+
+	float T[RAY_PACKET_SIZE], T1[RAY_PACKET_SIZE], Majorant[RAY_PACKET_SIZE], Position[3][RAY_PACKET_SIZE], Opacity[RAY_PACKET_SIZE], Intensity[RAY_PACKET_SIZE];
+
+	unsigned int Active = 0, Hits = 0;
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		// The packet fetch locates every lane, so lanes which never track need a defined position as well
+		for (int i = 0; i < 3; i++)
+			Position[i][l] = 0.0f;
+
+		if (!(Packet.Mask & RAY_PACKET_LANE(l)))
+			continue;
+
+		Ray R = Packet.R[l];
+
+		if (!Volume.BoundingBox.Intersect(R, R.MinT, R.MaxT))
+			continue;
+
+		Traversal[l]	= MacrocellTraversal(Volume.Macrocells, R.O, R.D, R.MinT, R.MaxT);
+		T[l]			= R.MinT;
+		T1[l]			= R.MinT;
+		Majorant[l]		= 0.0f;
+
+		Active |= RAY_PACKET_LANE(l);
+	}
+
+	while (Active)
+	{
+		// Tentative collisions, lanes which leave the volume retire
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			if (!SampleTentativeCollision(Traversal[l], T[l], T1[l], Majorant[l], Packet.RNG[l]))
+			{
+				Active &= ~RAY_PACKET_LANE(l);
+				continue;
+			}
+
+			for (int i = 0; i < 3; i++)
+				Position[i][l] = Packet.R[l].O[i] + Packet.R[l].D[i] * T[l];
+		}
+
+		if (!Active)
+			break;
+
+		FetchOpacityPacket(Volume, Position, Active, Opacity, Intensity, gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary());
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			Packet.Intensity[l] = (unsigned short)Intensity[l];
+
+			if (Packet.RNG[l].Get1() * Majorant[l] < GetExtinction(Opacity[l]))
+			{
+				for (int i = 0; i < 3; i++)
+					Packet.P[i][l] = Position[i][l];
+
+				Packet.T[l]	= T[l];
+				Hits		|= RAY_PACKET_LANE(l);
+				Active		&= ~RAY_PACKET_LANE(l);
+			}
+		}
+	}
+
+	FetchScatteringIntensities(Volume, Packet, Hits);
+
+	return Hits;
+}
+
+/*! Marches all rays of \a Packet through the volume and determines where scattering events occur, equivalent to calling IntersectVolume for each lane
+	@param[in,out] Packet Ray packet, receives the position, distance and intensity of each scattering event
+	@param[in] VolumeID ID of the volume
+	@return Mask of lanes for which a scattering event occurred
+*/
+DEVICE unsigned int IntersectVolume(RayPacket& Packet, const int& VolumeID = 0)
+{
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	if (gpTracer->VolumeProperty.GetFreePathSampling() == Enums::DeltaTracking)
+		return DeltaTrack(Volume, Packet, VolumeID);
+
+	const float StepSize = gStepFactorPrimary;
+
+	float O[3][RAY_PACKET_SIZE], D[3][RAY_PACKET_SIZE], Position[3][RAY_PACKET_SIZE], MinT[RAY_PACKET_SIZE], MaxT[RAY_PACKET_SIZE], S[RAY_PACKET_SIZE], Sum[RAY_PACKET_SIZE], Opacity[RAY_PACKET_SIZE], Intensity[RAY_PACKET_SIZE];
+
+	unsigned int Active = 0, Hits = 0;
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			O[i][l] = Packet.R[l].O[i];
+			D[i][l] = Packet.R[l].D[i];
+		}
+
+		MinT[l]	= 0.0f;
+		MaxT[l]	= 0.0f;
+		S[l]	= 0.0f;
+		Sum[l]	= 0.0f;
+
+		if (!(Packet.Mask & RAY_PACKET_LANE(l)))
+			continue;
+
+		Ray R = Packet.R[l];
+
+		if (!Volume.BoundingBox.Intersect(R, R.MinT, R.MaxT))
+			continue;
+
+		MinT[l]	= R.MinT;
+		MaxT[l]	= R.MaxT;
+		S[l]	= -log(Packet.RNG[l].Get1()) / gDensityScale;
+		MinT[l]	+= Packet.RNG[l].Get1() * StepSize;
+		
+		Active |= RAY_PACKET_LANE(l);
+	}
+
+	while (Active)
+	{
+		// Skip empty space and retire lanes which leave the volume before the next step
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			Volume.SkipEmptySpace(Vec3f(O[0][l], O[1][l], O[2][l]), Vec3f(D[0][l], D[1][l], D[2][l]), MinT[l], StepSize, MaxT[l]);
+
+			if (MinT[l] + StepSize >= MaxT[l])
+				Active &= ~RAY_PACKET_LANE(l);
+		}
+
+		if (!Active)
+			break;
+
+		for (int i = 0; i < 3; i++)
+			for (int l = 0; l < RAY_PACKET_SIZE; l++)
+				Position[i][l] = O[i][l] + D[i][l] * MinT[l];
+
+		FetchOpacityPacket(Volume, Position, Active, Opacity, Intensity, gStepFactorPrimary, gpTracer->VolumeProperty.GetLevelOfDetailPrimary());
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			Packet.Intensity[l]	= (unsigned short)Intensity[l];
+			Sum[l]				+= gDensityScale * Opacity[l] * StepSize;
+			MinT[l]				+= StepSize;
+
+			if (Sum[l] >= S[l])
+			{
+				for (int i = 0; i < 3; i++)
+					Packet.P[i][l] = Position[i][l];
+
+				Packet.T[l]	= MinT[l];
+				Hits		|= RAY_PACKET_LANE(l);
+				Active		&= ~RAY_PACKET_LANE(l);
+			}
+		}
+	}
+
+	FetchScatteringIntensities(Volume, Packet, Hits);
+
+	return Hits;
+}
+
+/*! Determines for all rays of \a Packet whether a scattering event occurs in the volume, equivalent to calling IntersectsVolume for each lane
+	@param[in,out] Packet Ray packet
+	@param[in] VolumeID ID of the volume
+	@return Mask of lanes for which a scattering event occurred
+*/
+DEVICE unsigned int IntersectsVolume(RayPacket& Packet, const int& VolumeID = 0)
+{
+	if (!gpTracer->VolumeProperty.GetShadows())
+		return 0;
+
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	const float StepSize = gStepFactorShadow;
+
+	float O[3][RAY_PACKET_SIZE], D[3][RAY_PACKET_SIZE], Position[3][RAY_PACKET_SIZE], MinT[RAY_PACKET_SIZE], MaxT[RAY_PACKET_SIZE], S[RAY_PACKET_SIZE], Sum[RAY_PACKET_SIZE], Opacity[RAY_PACKET_SIZE], Intensity[RAY_PACKET_SIZE];
+
+	unsigned int Active = 0, Hits = 0;
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			O[i][l] = Packet.R[l].O[i];
+			D[i][l] = Packet.R[l].D[i];
+		}
+
+		MinT[l]	= 0.0f;
+		MaxT[l]	= 0.0f;
+		S[l]	= 0.0f;
+		Sum[l]	= 0.0f;
+
+		if (!(Packet.Mask & RAY_PACKET_LANE(l)))
+			continue;
+
+		Ray R = Packet.R[l];
+
+		if (!Volume.BoundingBox.Intersect(R, R.MinT, MaxT[l]))
+			continue;
+
+		MinT[l]	= R.MinT;
+		MaxT[l]	= min(R.MaxT, MaxT[l]);
+		S[l]	= -log(Packet.RNG[l].Get1()) / gDensityScale;
+		MinT[l]	+= Packet.RNG[l].Get1() * StepSize;
+
+		// The ray can not be occluded if an upper bound of the optical thickness stays below S
+		if (gDensityScale * Volume.GetMaxOpacity(R(MinT[l]), R(MaxT[l])) * (MaxT[l] - MinT[l] + StepSize) < S[l])
+			continue;
+
+		Active |= RAY_PACKET_LANE(l);
+	}
+
+	while (Active)
+	{
+		// Skip empty space and retire lanes which have left the volume
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			Volume.SkipEmptySpace(Vec3f(O[0][l], O[1][l], O[2][l]), Vec3f(D[0][l], D[1][l], D[2][l]), MinT[l], StepSize, MaxT[l]);
+
+			if (MinT[l] > MaxT[l])
+				Active &= ~RAY_PACKET_LANE(l);
+		}
+
+		if (!Active)
+			break;
+
+		for (int i = 0; i < 3; i++)
+			for (int l = 0; l < RAY_PACKET_SIZE; l++)
+				Position[i][l] = O[i][l] + D[i][l] * MinT[l];
+
+		FetchOpacityPacket(Volume, Position, Active, Opacity, Intensity, gStepFactorShadow, gpTracer->VolumeProperty.GetLevelOfDetailShadow());
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			Sum[l]	+= gDensityScale * Opacity[l] * StepSize;
+			MinT[l]	+= StepSize;
+
+			if (Sum[l] >= S[l])
+			{
+				Hits	|= RAY_PACKET_LANE(l);
+				Active	&= ~RAY_PACKET_LANE(l);
+			}
+		}
+	}
+
+	return Hits;
+}
+
+/*! Estimates the transmittance of the volume for all rays of \a Packet, equivalent to calling Transmittance for each lane
+	@param[in,out] Packet Ray packet
+	@param[out] Transmittance Lane transmittance, one for lanes without a ray
+	@param[in] VolumeID ID of the volume
+*/
+DEVICE void Transmittance(RayPacket& Packet, float (&Transmittance)[RAY_PACKET_SIZE], const int& VolumeID = 0)
+{
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		Transmittance[l] = 1.0f;
+
+	if (gpTracer->VolumeProperty.GetFreePathSampling() != Enums::DeltaTracking)
+	{
+		const unsigned int Occluded = IntersectsVolume(Packet, VolumeID);
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (Occluded & RAY_PACKET_LANE(l))
+				Transmittance[l] = 0.0f;
+		}
+
+		return;
+	}
+
+	if (!gpTracer->VolumeProperty.GetShadows())
+		return;
+
+	Volume& Volume = gpVolumes[gpTracer->VolumeIDs[VolumeID]];
+
+	MacrocellTraversal Traversal[RAY_PACKET_SIZE];
+
+	float T[RAY_PACKET_SIZE], T1[RAY_PACKET_SIZE], Majorant[RAY_PACKET_SIZE], Position[3][RAY_PACKET_SIZE], Opacity[RAY_PACKET_SIZE], Intensity[RAY_PACKET_SIZE];
+
+	unsigned int Active = 0;
+
+	for (int l = 0; l < RAY_PACKET_SIZE; l++)
+	{
+		// The packet fetch locates every lane, so lanes which never track need a defined position as well
+		for (int i = 0; i < 3; i++)
+			Position[i][l] = 0.0f;
+
+		if (!(Packet.Mask & RAY_PACKET_LANE(l)))
+			continue;
+
+		Ray R = Packet.R[l];
+
+		float MaxT = 0.0f;
+
+		if (!Volume.BoundingBox.Intersect(R, R.MinT, MaxT))
+			continue;
+
+		R.MaxT = min(R.MaxT, MaxT);
+
+		Traversal[l]	= MacrocellTraversal(Volume.Macrocells, R.O, R.D, R.MinT, R.MaxT);
+		T[l]			= R.MinT;
+		T1[l]			= R.MinT;
+		Majorant[l]		= 0.0f;
+
+		Active |= RAY_PACKET_LANE(l);
+	}
+
+	while (Active)
+	{
+		// Tentative collisions, lanes which leave the volume retire
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			if (!SampleTentativeCollision(Traversal[l], T[l], T1[l], Majorant[l], Packet.RNG[l]))
+			{
+				Active &= ~RAY_PACKET_LANE(l);
+				continue;
+			}
+
+			for (int i = 0; i < 3; i++)
+				Position[i][l] = Packet.R[l].O[i] + Packet.R[l].D[i] * T[l];
+		}
+
+		if (!Active)
+			break;
+
+		FetchOpacityPacket(Volume, Position, Active, Opacity, Intensity, gStepFactorShadow, gpTracer->VolumeProperty.GetLevelOfDetailShadow());
+
+		for (int l = 0; l < RAY_PACKET_SIZE; l++)
+		{
+			if (!(Active & RAY_PACKET_LANE(l)))
+				continue;
+
+			if (!RatioTrack(Transmittance[l], GetExtinction(Opacity[l]), Majorant[l], Packet.RNG[l]))
+				Active &= ~RAY_PACKET_LANE(l);
+		}
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "enums.h"
+#include "vec2f.h"
+
+namespace ExposureRender
+{
+
+#define MAX_NO_REGIONS_OF_INTEREST		8
+#define MAX_REGION_OF_INTEREST_WEIGHT	16.0f
+
+/*! \class RegionOfInterest
+ * \brief Weighted region of the film in normalized film coordinates, pixels inside it are sampled more often than the periphery
+ */
+class EXPOSURE_RENDER_DLL RegionOfInterest
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE RegionOfInterest() :
+		Shape(Enums::RadialRegion),
+		MinUV(0.0f),
+		MaxUV(1.0f),
+		CenterUV(0.5f),
+		Radius(0.25f),
+		Weight(1.0f)
+	{
+	}
+
+	/*! Assignment operator
+		@param[in] Other Region of interest to copy
+		@return Copied region of interest
+	*/
+	HOST_DEVICE RegionOfInterest& operator = (const RegionOfInterest& Other)
+	{
+		this->Shape		= Other.Shape;
+		this->MinUV		= Other.MinUV;
+		this->MaxUV		= Other.MaxUV;
+		this->CenterUV	= Other.CenterUV;
+		this->Radius	= Other.Radius;
+		this->Weight	= Other.Weight;
+
+		return *this;
+	}
+
+	/*! Gets the sampling weight at \a UV
+		@param[in] UV Normalized film coordinates
+		@return Sampling weight, zero outside the region
+	*/
+	HOST_DEVICE float GetWeight(const Vec2f& UV) const
+	{
+		switch (this->Shape)
+		{
+			case Enums::RectangularRegion:
+				return UV[0] >= this->MinUV[0] && UV[0] <= this->MaxUV[0] && UV[1] >= this->MinUV[1] && UV[1] <= this->MaxUV[1] ? this->Weight : 0.0f;
+
+			case Enums::RadialRegion:
+				return this->Radius > 0.0f ? this->Weight * max(1.0f - (UV - this->CenterUV).Length() / this->Radius, 0.0f) : 0.0f;
+		}
+
+		return 0.0f;
+	}
+
+	GET_SET_MACRO(HOST_DEVICE, Shape, Enums::RegionShape)
+	GET_SET_MACRO(HOST_DEVICE, MinUV, Vec2f)
+	GET_SET_MACRO(HOST_DEVICE, MaxUV, Vec2f)
+	GET_SET_MACRO(HOST_DEVICE, CenterUV, Vec2f)
+	GET_SET_MACRO(HOST_DEVICE, Radius, float)
+	GET_SET_MACRO(HOST_DEVICE, Weight, float)
+
+protected:
+	Enums::RegionShape	Shape;			/*! Shape of the region */
+	Vec2f				MinUV;			/*! Minimum corner of a rectangular region */
+	Vec2f				MaxUV;			/*! Maximum corner of a rectangular region */
+	Vec2f				CenterUV;		/*! Center of a radial region */
+	float				Radius;			/*! Radius of a radial region */
+	float				Weight;			/*! Sampling weight in (0, MAX_REGION_OF_INTEREST_WEIGHT], relative to the largest weight on the film, see FrameBuffer::SetTileWeights */
+};
+
+/*! \class RegionsOfInterest
+ * \brief Fixed size list of regions of interest
+ */
+class EXPOSURE_RENDER_DLL RegionsOfInterest
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE RegionsOfInterest() :
+		NoRegions(0)
+	{
+	}
+
+	/*! Assignment operator
+		@param[in] Other Regions of interest to copy
+		@return Copied regions of interest
+	*/
+	HOST_DEVICE RegionsOfInterest& operator = (const RegionsOfInterest& Other)
+	{
+		for (int i = 0; i < Other.NoRegions; i++)
+			this->Regions[i] = Other.Regions[i];
+
+		this->NoRegions = Other.NoRegions;
+
+		return *this;
+	}
+
+	/*! Gets region of interest \a ID
+		@param[in] ID Index of the region
+		@return Region of interest
+	*/
+	HOST_DEVICE const RegionOfInterest& operator [] (const int& ID) const
+	{
+		return this->Regions[ID];
+	}
+
+	/*! Adds a region of interest, regions beyond MAX_NO_REGIONS_OF_INTEREST are ignored
+		@param[in] Region Region of interest
+	*/
+	HOST_DEVICE void Add(const RegionOfInterest& Region)
+	{
+		if (this->NoRegions >= MAX_NO_REGIONS_OF_INTEREST)
+			return;
+
+		this->Regions[this->NoRegions] = Region;
+		this->NoRegions++;
+	}
+
+	/*! Removes all regions of interest */
+	HOST_DEVICE void Reset()
+	{
+		this->NoRegions = 0;
+	}
+
+	/*! Gets the sampling weight at \a UV, which is the largest weight of the regions and \a PeripheralWeight
+		@param[in] UV Normalized film coordinates
+		@param[in] PeripheralWeight Sampling weight outside the regions
+		@return Sampling weight in [0.01, MAX_REGION_OF_INTEREST_WEIGHT]
+	*/
+	HOST_DEVICE float GetWeight(const Vec2f& UV, const float& PeripheralWeight) const
+	{
+		float Weight = PeripheralWeight;
+
+		for (int i = 0; i < this->NoRegions; i++)
+			Weight = max(Weight, this->Regions[i].GetWeight(UV));
+
+		return Clamp(Weight, 0.01f, MAX_REGION_OF_INTEREST_WEIGHT);
+	}
+
+	GET_MACRO(HOST_DEVICE, NoRegions, int)
+
+protected:
+	RegionOfInterest	Regions[MAX_NO_REGIONS_OF_INTEREST];	/*! Regions of interest */
+	int					NoRegions;								/*! Number of regions of interest */
+};
+
+}
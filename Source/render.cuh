@@ -1,106 +1,201 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "samplecamera.cuh"
-#include "samplelight.cuh"
-#include "sampleshader.cuh"
-#include "dvr.cuh"
-#include "filtering.cuh"
-#include "estimate.cuh"
-#include "tonemap.cuh"
-#include "blendrgbauc.cuh"
-#include "gaussianfilterrgbauc.cuh"
-#include "gaussianfilterxyzaf.cuh"
-
-#include <thrust/remove.h>
-
-#define SAMPLE_LIGHT
-#define SAMPLE_SHADER
-
-namespace ExposureRender
-{
-
-struct IsInvalid
-{
-	HOST_DEVICE bool operator()(const int& Value)
-	{
-		return Value < 0;
-	}
-};
-
-void RemoveRedundantSamples(Tracer& Tracer, int& NoSamples)
-{
-	thrust::device_ptr<int> DevicePtr(Tracer.FrameBuffer.IDs.GetData()); 
-	thrust::device_ptr<int> DevicePtrEnd = thrust::remove_if(DevicePtr, DevicePtr + Tracer.FrameBuffer.IDs.GetNoElements(), IsInvalid());
-
-	NoSamples = DevicePtrEnd - DevicePtr;
-}
-
-void Render(Tracer& Tracer, Statistics& Statistics)
-{
-	Tracer.FrameBuffer.DisplayEstimate.Reset();
-
-	switch (Tracer.RenderMode)
-	{
-		case Enums::StandardRayCasting:
-		{
-			if (Tracer.NoEstimates > 0)
-				return;
-			
-			Dvr(Tracer, Statistics);
-			GaussianFilterRGBAuc(Statistics, 1, Tracer.FrameBuffer.DVR);
-			BlendRGBAuc(Statistics, Tracer.FrameBuffer.DisplayEstimate, Tracer.FrameBuffer.DVR);
-
-			break;
-		}
-		
-		case Enums::StochasticRayCasting:
-		{
-			SampleCamera(Tracer, Statistics);
-			
-			Statistics.SetStatistic("No. camera rays", "%.2f", "mrays/frame", (float)Tracer.FrameBuffer.Resolution.CumulativeProduct() / 1000000.0f);
-
-			int NoSamples = 0;
-
-			RemoveRedundantSamples(Tracer, NoSamples);
-
-			if (NoSamples > 0)
-			{
-				Statistics.SetStatistic("No. light rays", "%.2f", "mrays/frame", (float)(NoSamples * 2) / 1000000.0f);
-
-#ifdef SAMPLE_LIGHT
-				SampleLight(Tracer, Statistics, NoSamples);
-#endif
-
-#ifdef SAMPLE_SHADER
-				SampleShader(Tracer, Statistics, NoSamples);
-#endif
-			}
-
-			GaussianFilterXYZAf(Statistics, 1, Tracer.FrameBuffer.FrameEstimate);
-			ComputeEstimate(Tracer, Statistics);
-			ToneMap(Tracer, Statistics);
-			GaussianFilterRGBAuc(Statistics, 1, Tracer.FrameBuffer.RunningEstimateRGB);
-			BlendRGBAuc(Statistics, Tracer.FrameBuffer.DisplayEstimate, Tracer.FrameBuffer.RunningEstimateRGB);
-
-			break;
-		}
-	}
-}
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "samplecamera.cuh"
+#include "samplelight.cuh"
+#include "sampleshader.cuh"
+#include "dvr.cuh"
+#include "filtering.cuh"
+#include "estimate.cuh"
+#include "tonemap.cuh"
+#include "blendrgbauc.cuh"
+#include "gaussianfilterrgbauc.cuh"
+#include "gaussianfilterxyzaf.cuh"
+
+#ifndef ER_CPU
+	#include <thrust/copy.h>
+	#include <thrust/count.h>
+#endif
+
+#define SAMPLE_LIGHT
+#define SAMPLE_SHADER
+
+namespace ExposureRender
+{
+
+#define COMPACTION_CHUNK_SIZE		4096
+
+struct IsValid
+{
+	HOST_DEVICE bool operator()(const int& Value)
+	{
+		return Value >= 0;
+	}
+};
+
+/*! Compacts the IDs of the samples which need lighting into a dense queue, the lighting stages only iterate the first \a NoSamples entries of the queue
+	@param[in] Tracer Tracer
+	@param[out] NoSamples Number of samples in the queue
+*/
+void RemoveRedundantSamples(Tracer& Tracer, int& NoSamples)
+{
+	const int NoIDs = Tracer.FrameBuffer.IDs.GetNoElements();
+
+#ifdef ER_CPU
+	const int* pIDs	= Tracer.FrameBuffer.IDs.GetData();
+	int* pQueue		= Tracer.FrameBuffer.Queue.GetData();
+
+	// Parallel prefix sum compaction, every chunk counts its live samples, the exclusive scan of the counts gives the offset at which each chunk writes its samples
+	const int NoChunks = (NoIDs + COMPACTION_CHUNK_SIZE - 1) / COMPACTION_CHUNK_SIZE;
+
+	std::vector<int> Offsets(NoChunks + 1, 0);
+
+	Cpu::ThreadPool::Get().Run(NoChunks, [&](int Chunk)
+	{
+		int NoLive = 0;
+
+		for (int i = Chunk * COMPACTION_CHUNK_SIZE; i < min((Chunk + 1) * COMPACTION_CHUNK_SIZE, NoIDs); i++)
+			NoLive += pIDs[i] >= 0;
+
+		Offsets[Chunk + 1] = NoLive;
+	});
+
+	for (int Chunk = 0; Chunk < NoChunks; Chunk++)
+		Offsets[Chunk + 1] += Offsets[Chunk];
+
+	Cpu::ThreadPool::Get().Run(NoChunks, [&](int Chunk)
+	{
+		int* pLive = pQueue + Offsets[Chunk];
+
+		for (int i = Chunk * COMPACTION_CHUNK_SIZE; i < min((Chunk + 1) * COMPACTION_CHUNK_SIZE, NoIDs); i++)
+		{
+			if (pIDs[i] >= 0)
+				*pLive++ = pIDs[i];
+		}
+	});
+
+	NoSamples = Offsets[NoChunks];
+#else
+	thrust::device_ptr<int> IDsPtr(Tracer.FrameBuffer.IDs.GetData()); 
+	thrust::device_ptr<int> QueuePtr(Tracer.FrameBuffer.Queue.GetData()); 
+	thrust::device_ptr<int> QueuePtrEnd = thrust::copy_if(IDsPtr, IDsPtr + NoIDs, QueuePtr, IsValid());
+
+	NoSamples = QueuePtrEnd - QueuePtr;
+#endif
+}
+
+void CountConvergedTiles(Tracer& Tracer, Statistics& Statistics)
+{
+#ifdef ER_CPU
+	unsigned char* pConverged = Tracer.FrameBuffer.TileConverged.GetData();
+
+	Tracer.NoConvergedTiles = (int)std::count(pConverged, pConverged + Tracer.FrameBuffer.TileConverged.GetNoElements(), 1);
+#else
+	thrust::device_ptr<unsigned char> DevicePtr(Tracer.FrameBuffer.TileConverged.GetData());
+
+	Tracer.NoConvergedTiles = (int)thrust::count(DevicePtr, DevicePtr + Tracer.FrameBuffer.TileConverged.GetNoElements(), 1);
+#endif
+
+	Statistics.SetStatistic("Converged tiles", "%.1f", "%", 100.0f * (float)Tracer.NoConvergedTiles / (float)max(Tracer.FrameBuffer.TileConverged.GetNoElements(), 1));
+}
+
+/*! Renders one estimate into the running estimate, ray casting only renders the first estimate after a restart
+	@param[in] Tracer Tracer
+	@param[in] Statistics Statistics
+*/
+void RenderEstimate(Tracer& Tracer, Statistics& Statistics)
+{
+	switch (Tracer.RenderMode)
+	{
+		case Enums::StandardRayCasting:
+		{
+			if (Tracer.NoEstimates > 0)
+				return;
+			
+			Dvr(Tracer, Statistics);
+			GaussianFilterRGBAuc(Statistics, 1, Tracer.FrameBuffer.DVR);
+
+			break;
+		}
+		
+		case Enums::StochasticRayCasting:
+		{
+			// Converged tiles are no longer sampled, once all of them converged no estimate is rendered
+			if (Tracer.NoConvergedTiles >= Tracer.FrameBuffer.TileConverged.GetNoElements())
+				return;
+
+			SampleCamera(Tracer, Statistics);
+			
+			Statistics.SetStatistic("No. camera rays", "%.2f", "mrays/frame", (float)Tracer.FrameBuffer.Resolution.CumulativeProduct() / 1000000.0f);
+
+			int NoSamples = 0;
+
+			RemoveRedundantSamples(Tracer, NoSamples);
+
+			if (NoSamples > 0)
+			{
+				Statistics.SetStatistic("No. light rays", "%.2f", "mrays/frame", (float)(NoSamples * 2) / 1000000.0f);
+
+#ifdef SAMPLE_LIGHT
+				SampleLight(Tracer, Statistics, NoSamples);
+#endif
+
+#ifdef SAMPLE_SHADER
+				SampleShader(Tracer, Statistics, NoSamples);
+#endif
+			}
+
+			ComputeVariance(Tracer, Statistics);
+			GaussianFilterXYZAf(Statistics, 1, Tracer.FrameBuffer.FrameEstimate);
+			ComputeEstimate(Tracer, Statistics);
+			ComputeConvergence(Tracer, Statistics);
+			CountConvergedTiles(Tracer, Statistics);
+
+			break;
+		}
+	}
+}
+
+/*! Converts the running estimate of \a Tracer into its display estimate
+	@param[in] Tracer Tracer
+	@param[in] Statistics Statistics
+*/
+void RenderDisplayEstimate(Tracer& Tracer, Statistics& Statistics)
+{
+	Tracer.FrameBuffer.DisplayEstimate.Reset();
+
+	switch (Tracer.RenderMode)
+	{
+		case Enums::StandardRayCasting:
+		{
+			BlendRGBAuc(Statistics, Tracer.FrameBuffer.DisplayEstimate, Tracer.FrameBuffer.DVR);
+			break;
+		}
+		
+		case Enums::StochasticRayCasting:
+		{
+			ToneMap(Tracer, Statistics);
+			GaussianFilterRGBAuc(Statistics, 1, Tracer.FrameBuffer.RunningEstimateRGB);
+			BlendRGBAuc(Statistics, Tracer.FrameBuffer.DisplayEstimate, Tracer.FrameBuffer.RunningEstimateRGB);
+
+			break;
+		}
+	}
+}
+
+}
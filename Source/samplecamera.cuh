@@ -1,89 +1,203 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "macros.cuh"
-#include "intersect.cuh"
-
-#include "textures.h"
-
-namespace ExposureRender
-{
-
-KERNEL void KrnlSampleCamera()
-{
-	KERNEL_2D(gpTracer->FrameBuffer.Resolution[0], gpTracer->FrameBuffer.Resolution[1])
-
-	// Get current sample
-	RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx, IDy);
-
-	// Sample ID reference
-	int& SampleID = gpTracer->FrameBuffer.IDs(IDx, IDy);
-
-	SampleID = -1;
-
-	// Set the associated film plane UV coordinates
-	Sample.UV[0] = IDx;
-	Sample.UV[1] = IDy;
-	
-	// Initalize the associated pixel with black
-	ColorXYZAf& FrameEstimate = gpTracer->FrameBuffer.FrameEstimate(IDx, IDy);
-	
-	FrameEstimate = ColorXYZAf::Black();
-
-	// Initialize the random number generator
-	RNG RNG(&gpTracer->FrameBuffer.RandomSeeds1(IDx, IDy), &gpTracer->FrameBuffer.RandomSeeds2(IDx, IDy));
-	
-	// Generate
-	gpTracer->Camera.Sample(Sample.Ray, Vec2i(IDx, IDy), RNG);
-	
-	// Reset the sample intersection
-	Sample.Intersection = Intersection();
-
-	// Intersections
-	if (Intersect(Sample.Ray, RNG, Sample.Intersection))
-	{
-		if (Sample.Intersection.GetScatterType() == Enums::Light)
-		{
-			ColorXYZf Le = gpObjects[Sample.Intersection.GetID()].Multiplier * EvaluateTexture(gpObjects[Sample.Intersection.GetID()].EmissionTextureID, Sample.Intersection.GetUV());
-		
-			if (gpObjects[Sample.Intersection.GetID()].EmissionUnit == Enums::Power)
-				Le /= gpObjects[Sample.Intersection.GetID()].Shape.GetArea();
-
-			FrameEstimate[0] = Le[0];
-			FrameEstimate[1] = Le[1];
-			FrameEstimate[2] = Le[2];
-
-			SampleID = -1;
-		}
-		else
-		{
-			SampleID = IDk;
-		}
-	}
-
-	// Adjust alpha
-	FrameEstimate[3] = Sample.Intersection.GetValid() ? 1.0f : 0.0f;
-}
-
-void SampleCamera(Tracer& Tracer, Statistics& Statistics)
-{
-	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.Resolution[0], Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
-	LAUNCH_CUDA_KERNEL_TIMED((KrnlSampleCamera<<<GridDim, BlockDim>>>()), "Sample camera"); 
-}
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "macros.cuh"
+#include "intersect.cuh"
+#include "raypacket.h"
+
+#include "textures.h"
+
+namespace ExposureRender
+{
+
+/*! Initializes the camera sample of pixel (\a IDx, \a IDy) and generates its primary ray
+	@param[in] IDx Pixel x coordinate
+	@param[in] IDy Pixel y coordinate
+	@param[in] RNG Random number generator of the pixel
+*/
+DEVICE void InitializeCameraSample(const int& IDx, const int& IDy, RNG& RNG)
+{
+	// Get current sample
+	RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx, IDy);
+
+	gpTracer->FrameBuffer.IDs(IDx, IDy) = -1;
+
+	// Set the associated film plane UV coordinates
+	Sample.UV[0] = IDx;
+	Sample.UV[1] = IDy;
+	
+	// Initalize the associated pixel with black
+	gpTracer->FrameBuffer.FrameEstimate(IDx, IDy) = ColorXYZAf::Black();
+
+	// Generate
+	gpTracer->Camera.Sample(Sample.Ray, Vec2i(IDx, IDy), RNG);
+	
+	// Reset the sample intersection
+	Sample.Intersection = Intersection();
+}
+
+/*! Skips the camera sample of pixel (\a IDx, \a IDy) because its tile converged or is not sampled by this estimate, the frame estimate takes the running estimate so that filtering the frame estimate of neighbouring pixels is not affected
+	@param[in] IDx Pixel x coordinate
+	@param[in] IDy Pixel y coordinate
+*/
+DEVICE void SkipCameraSample(const int& IDx, const int& IDy)
+{
+	gpTracer->FrameBuffer.IDs(IDx, IDy) = -1;
+
+	gpTracer->FrameBuffer.FrameEstimate(IDx, IDy) = gpTracer->FrameBuffer.RunningEstimateXYZ(IDx, IDy);
+}
+
+/*! Processes the intersection of the camera sample of pixel (\a IDx, \a IDy), directly visible lights are added to the frame estimate and other scattering events are queued for lighting
+	@param[in] IDx Pixel x coordinate
+	@param[in] IDy Pixel y coordinate
+	@param[in] IDk Pixel index
+*/
+DEVICE void ProcessCameraSample(const int& IDx, const int& IDy, const int& IDk)
+{
+	RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx, IDy);
+
+	int& SampleID = gpTracer->FrameBuffer.IDs(IDx, IDy);
+
+	ColorXYZAf& FrameEstimate = gpTracer->FrameBuffer.FrameEstimate(IDx, IDy);
+
+	if (Sample.Intersection.GetValid())
+	{
+		if (Sample.Intersection.GetScatterType() == Enums::Light)
+		{
+			ColorXYZf Le = gpObjects[Sample.Intersection.GetID()].Multiplier * EvaluateTexture(gpObjects[Sample.Intersection.GetID()].EmissionTextureID, Sample.Intersection.GetUV());
+		
+			if (gpObjects[Sample.Intersection.GetID()].EmissionUnit == Enums::Power)
+				Le /= gpObjects[Sample.Intersection.GetID()].Shape.GetArea();
+
+			FrameEstimate[0] = Le[0];
+			FrameEstimate[1] = Le[1];
+			FrameEstimate[2] = Le[2];
+
+			SampleID = -1;
+		}
+		else
+		{
+			SampleID = IDk;
+		}
+	}
+
+	// Adjust alpha
+	FrameEstimate[3] = Sample.Intersection.GetValid() ? 1.0f : 0.0f;
+}
+
+KERNEL void KrnlSampleCamera()
+{
+	KERNEL_2D(gpTracer->FrameBuffer.Resolution[0], gpTracer->FrameBuffer.Resolution[1])
+
+	if (!gpTracer->FrameBuffer.GetSampled(IDx, IDy, gpTracer->NoEstimates))
+	{
+		SkipCameraSample(IDx, IDy);
+		return;
+	}
+
+	// Initialize the random number generator
+	RNG RNG(&gpTracer->FrameBuffer.RandomSeeds1(IDx, IDy), &gpTracer->FrameBuffer.RandomSeeds2(IDx, IDy));
+	
+	InitializeCameraSample(IDx, IDy, RNG);
+
+	RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx, IDy);
+
+	// Intersections
+	Intersect(Sample.Ray, RNG, Sample.Intersection);
+
+	ProcessCameraSample(IDx, IDy, IDk);
+}
+
+#ifdef ER_CPU
+/*! Samples the camera for a row of RAY_PACKET_SIZE pixels, the primary rays are marched through the volume as a packet */
+KERNEL void KrnlSampleCameraPacket()
+{
+	const int Width		= gpTracer->FrameBuffer.Resolution[0];
+	const int Height	= gpTracer->FrameBuffer.Resolution[1];
+	const int IDx		= (blockIdx.x * blockDim.x + threadIdx.x) * RAY_PACKET_SIZE;
+	const int IDy		= blockIdx.y * blockDim.y + threadIdx.y;
+
+	if (IDx >= Width || IDy >= Height)
+		return;
+
+	const int NoLanes = min(RAY_PACKET_SIZE, Width - IDx);
+
+	// A packet lies within a single convergence tile
+	if (!gpTracer->FrameBuffer.GetSampled(IDx, IDy, gpTracer->NoEstimates))
+	{
+		for (int l = 0; l < NoLanes; l++)
+			SkipCameraSample(IDx + l, IDy);
+
+		return;
+	}
+
+	RayPacket Packet;
+
+	for (int l = 0; l < NoLanes; l++)
+	{
+		RNG RNG(&gpTracer->FrameBuffer.RandomSeeds1(IDx + l, IDy), &gpTracer->FrameBuffer.RandomSeeds2(IDx + l, IDy));
+
+		InitializeCameraSample(IDx + l, IDy, RNG);
+
+		RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx + l, IDy);
+
+		IntersectObjects(Sample.Ray, Sample.Intersection);
+
+		Packet.Set(l, Sample.Ray, RNG);
+	}
+
+	const unsigned int Hits = IntersectVolume(Packet);
+
+	for (int l = 0; l < NoLanes; l++)
+	{
+		RenderSample& Sample = gpTracer->FrameBuffer.Samples(IDx + l, IDy);
+
+		if ((Hits & RAY_PACKET_LANE(l)) && (!Sample.Intersection.GetValid() || Packet.T[l] < Sample.Intersection.GetT()))
+		{
+			const Vec3f P(Packet.P[0][l], Packet.P[1][l], Packet.P[2][l]);
+
+			Intersection Int;
+
+			Int.SetValid(true);
+			Int.SetP(P);
+			Int.SetIntensity(Packet.Intensity[l]);
+			Int.SetWo(-Sample.Ray.D);
+			Int.SetN(gpVolumes[gpTracer->VolumeIDs[0]].NormalizedGradient(P, Enums::CentralDifferences));
+			Int.SetT(Packet.T[l]);
+			Int.SetScatterType(Enums::Volume);
+
+			Sample.Intersection = Int;
+		}
+
+		ProcessCameraSample(IDx + l, IDy, IDy * Width + IDx + l);
+	}
+}
+#endif
+
+void SampleCamera(Tracer& Tracer, Statistics& Statistics)
+{
+#ifdef ER_CPU
+	LAUNCH_DIMENSIONS((Tracer.FrameBuffer.Resolution[0] + RAY_PACKET_SIZE - 1) / RAY_PACKET_SIZE, Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
+	LAUNCH_KERNEL_TIMED(KrnlSampleCameraPacket, (), "Sample camera"); 
+#else
+	LAUNCH_DIMENSIONS(Tracer.FrameBuffer.Resolution[0], Tracer.FrameBuffer.Resolution[1], 1, BLOCK_W, BLOCK_H, 1)
+	LAUNCH_KERNEL_TIMED(KrnlSampleCamera, (), "Sample camera"); 
+#endif
+}
+
+}
@@ -0,0 +1,460 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "buffer1d.h"
+#include "buffer3d.h"
+#include "boundingbox.h"
+#include "transferfunction1d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "exception.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define SPARSE_LEAF_NO_VOXELS_LOG2		(3 * VOXEL_BRICK_SIZE_LOG2)
+#define SPARSE_LEAF_NO_VOXELS			(1 << SPARSE_LEAF_NO_VOXELS_LOG2)
+#define SPARSE_NODE_NO_CHILDREN			(1 << (3 * SPARSE_NODE_SIZE_LOG2))
+#define SPARSE_INACTIVE					-1
+#define SPARSE_EMPTY					-2
+
+/*! \class SparseVoxelReader
+ * \brief Reads single voxels of a sparse voxel tree, voxel indices are those of the sparse voxel layout (see ComputeVoxelOffsets). Voxels of leaves which are not stored read as the background value
+ */
+class SparseVoxelReader
+{
+public:
+	/*! Constructor
+		@param[in] pRoot Internal node index per root grid cell
+		@param[in] pNodes Leaf index per child of all internal nodes
+		@param[in] pLeaves Voxels of all stored leaves
+		@param[in] Background Value of voxels which are not stored
+	*/
+	HOST_DEVICE SparseVoxelReader(const int* pRoot, const int* pNodes, const unsigned short* pLeaves, const unsigned short& Background) :
+		pRoot(pRoot),
+		pNodes(pNodes),
+		pLeaves(pLeaves),
+		Background(Background)
+	{
+	}
+
+	/*! Reads voxel \a ID
+		@param[in] ID Voxel index in the sparse voxel layout
+		@return Voxel value
+	*/
+	HOST_DEVICE unsigned short operator[](const int& ID) const
+	{
+		const int Node = this->pRoot[ID >> SPARSE_ROOT_SHIFT];
+
+		if (Node < 0)
+			return this->Background;
+
+		const int Leaf = this->pNodes[(Node << (3 * SPARSE_NODE_SIZE_LOG2)) | ((ID >> SPARSE_LEAF_NO_VOXELS_LOG2) & (SPARSE_NODE_NO_CHILDREN - 1))];
+
+		if (Leaf < 0)
+			return this->Background;
+
+		return this->pLeaves[(Leaf << SPARSE_LEAF_NO_VOXELS_LOG2) | (ID & (SPARSE_LEAF_NO_VOXELS - 1))];
+	}
+
+protected:
+	const int*				pRoot;			/*! Internal node index per root grid cell */
+	const int*				pNodes;			/*! Leaf index per child of all internal nodes */
+	const unsigned short*	pLeaves;		/*! Voxels of all stored leaves */
+	unsigned short			Background;		/*! Value of voxels which are not stored */
+};
+
+typedef BasicVoxelSampler<SparseVoxelReader> SparseVoxelSampler;
+
+/*! \class SparseVoxels
+ * \brief Three level voxel tree for mostly empty volumes. A dense root grid points to internal nodes of SPARSE_NODE_SIZE^3 leaves, and only leaves of VOXEL_BRICK_SIZE^3 voxels which contain other values than the background (the volume minimum) are stored. Memory therefore scales with the occupied part of the volume. Children which are not stored are either inactive, within reach of trilinear samples of a stored leaf, or empty, in which case every sample inside them is the background and rays may step over them as a whole when the background is transparent
+ */
+class EXPOSURE_RENDER_DLL SparseVoxels
+{
+public:
+	/*! Default constructor */
+	HOST SparseVoxels() :
+		Resolution(),
+		Background(0),
+		MinP(),
+		VoxelSize(1.0f),
+		InvVoxelSize(1.0f),
+		Root("Device Sparse Root", Enums::Device),
+		Nodes("Device Sparse Nodes", Enums::Device),
+		Leaves("Device Sparse Leaves", Enums::Device),
+		Offsets("Device Sparse Voxel Offsets", Enums::Device),
+		BackgroundOpacity("Device Sparse Background Opacity", Enums::Device)
+	{
+	}
+
+	/*! Builds the sparse voxel tree of \a Voxels
+		@param[in] Voxels Scanline ordered voxels
+	*/
+	HOST void Set(const VoxelSource& Voxels)
+	{
+		this->Resolution = Voxels.GetResolution();
+
+		const Vec3i NoLeaves((this->Resolution[0] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE, (this->Resolution[1] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE, (this->Resolution[2] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE);
+		const Vec3i NoNodes((NoLeaves[0] + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE, (NoLeaves[1] + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE, (NoLeaves[2] + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE);
+
+		if (NoNodes.CumulativeProduct() > (INT_MAX >> SPARSE_ROOT_SHIFT))
+		{
+			char Message[MAX_CHAR_SIZE];
+
+			sprintf_s(Message, MAX_CHAR_SIZE, "%s failed, a %d x %d x %d volume is too large for the sparse voxel layout", __FUNCTION__, this->Resolution[0], this->Resolution[1], this->Resolution[2]);
+
+			throw(Exception(Enums::Error, Message));
+		}
+
+		// The background is the minimum of the volume
+		std::vector<unsigned short> SliceMin(this->Resolution[2], USHRT_MAX);
+
+		const auto MinSlice = [&](int Z)
+		{
+			std::vector<unsigned short> Row(this->Resolution[0]);
+
+			for (int Y = 0; Y < this->Resolution[1]; Y++)
+			{
+				Voxels.ReadRow(Y, Z, Row.data());
+
+				for (int X = 0; X < this->Resolution[0]; X++)
+					SliceMin[Z] = min(SliceMin[Z], Row[X]);
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(this->Resolution[2], MinSlice);
+#else
+		for (int Z = 0; Z < this->Resolution[2]; Z++)
+			MinSlice(Z);
+#endif
+
+		this->Background = USHRT_MAX;
+
+		for (size_t i = 0; i < SliceMin.size(); i++)
+			this->Background = min(this->Background, SliceMin[i]);
+
+		// A leaf is active when one of its voxels differs from the background
+		std::vector<unsigned char> Active(NoLeaves.CumulativeProduct(), 0);
+
+		const auto ActivateSlab = [&](int Z)
+		{
+			for (int Y = 0; Y < NoLeaves[1]; Y++)
+			{
+				for (int X = 0; X < NoLeaves[0]; X++)
+				{
+					unsigned char& Leaf = Active[(Z * NoLeaves[1] + Y) * NoLeaves[0] + X];
+
+					VisitVoxelBrick(Voxels, X, Y, Z, [&](int, unsigned short Value)
+					{
+						Leaf |= Value != this->Background;
+					});
+				}
+			}
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(NoLeaves[2], ActivateSlab);
+#else
+		for (int Z = 0; Z < NoLeaves[2]; Z++)
+			ActivateSlab(Z);
+#endif
+
+		// Trilinear samples reach one voxel into the next leaf, so a leaf next to an active leaf is not empty
+		std::vector<unsigned char> Occupied(Active.size(), 0);
+
+		for (int Z = 0; Z < NoLeaves[2]; Z++)
+		{
+			for (int Y = 0; Y < NoLeaves[1]; Y++)
+			{
+				for (int X = 0; X < NoLeaves[0]; X++)
+				{
+					if (!Active[(Z * NoLeaves[1] + Y) * NoLeaves[0] + X])
+						continue;
+
+					for (int z = max(Z - 1, 0); z <= min(Z + 1, NoLeaves[2] - 1); z++)
+						for (int y = max(Y - 1, 0); y <= min(Y + 1, NoLeaves[1] - 1); y++)
+							for (int x = max(X - 1, 0); x <= min(X + 1, NoLeaves[0] - 1); x++)
+								Occupied[(z * NoLeaves[1] + y) * NoLeaves[0] + x] = 1;
+				}
+			}
+		}
+
+		std::vector<int> Root(NoNodes.CumulativeProduct(), SPARSE_EMPTY);
+		std::vector<int> Nodes;
+		std::vector<Vec3i> LeafIndices;
+
+		for (int NZ = 0; NZ < NoNodes[2]; NZ++)
+		{
+			for (int NY = 0; NY < NoNodes[1]; NY++)
+			{
+				for (int NX = 0; NX < NoNodes[0]; NX++)
+				{
+					std::vector<int> Children(SPARSE_NODE_NO_CHILDREN, SPARSE_EMPTY);
+
+					bool AnyActive = false, AnyOccupied = false;
+
+					for (int z = 0; z < SPARSE_NODE_SIZE; z++)
+					{
+						for (int y = 0; y < SPARSE_NODE_SIZE; y++)
+						{
+							for (int x = 0; x < SPARSE_NODE_SIZE; x++)
+							{
+								const Vec3i Leaf(NX * SPARSE_NODE_SIZE + x, NY * SPARSE_NODE_SIZE + y, NZ * SPARSE_NODE_SIZE + z);
+
+								if (Leaf[0] >= NoLeaves[0] || Leaf[1] >= NoLeaves[1] || Leaf[2] >= NoLeaves[2])
+									continue;
+
+								const int ID = (Leaf[2] * NoLeaves[1] + Leaf[1]) * NoLeaves[0] + Leaf[0];
+
+								int& Child = Children[(z * SPARSE_NODE_SIZE + y) * SPARSE_NODE_SIZE + x];
+
+								if (Active[ID])
+								{
+									Child = (int)LeafIndices.size();
+									LeafIndices.push_back(Leaf);
+									AnyActive = true;
+								}
+								else if (Occupied[ID])
+								{
+									Child = SPARSE_INACTIVE;
+								}
+
+								AnyOccupied |= Occupied[ID] != 0;
+							}
+						}
+					}
+
+					int& Node = Root[(NZ * NoNodes[1] + NY) * NoNodes[0] + NX];
+
+					if (AnyActive)
+					{
+						Node = (int)(Nodes.size() / SPARSE_NODE_NO_CHILDREN);
+						Nodes.insert(Nodes.end(), Children.begin(), Children.end());
+					}
+					else if (AnyOccupied)
+					{
+						Node = SPARSE_INACTIVE;
+					}
+				}
+			}
+		}
+
+		Buffer1D<unsigned short> Leaves("Host Sparse Leaves", Enums::Host);
+
+		Leaves.Resize(Vec<int, 1>((int)LeafIndices.size() * SPARSE_LEAF_NO_VOXELS));
+
+		const auto CopyLeaf = [&](int ID)
+		{
+			unsigned short* pLeaf = Leaves.GetData() + ID * SPARSE_LEAF_NO_VOXELS;
+
+			VisitVoxelBrick(Voxels, LeafIndices[ID][0], LeafIndices[ID][1], LeafIndices[ID][2], [&](int Voxel, unsigned short Value)
+			{
+				pLeaf[Voxel] = Value;
+			});
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run((int)LeafIndices.size(), CopyLeaf);
+#else
+		for (int ID = 0; ID < (int)LeafIndices.size(); ID++)
+			CopyLeaf(ID);
+#endif
+
+		Buffer1D<int> Offsets("Host Sparse Voxel Offsets", Enums::Host);
+
+		Offsets.Resize(Vec<int, 1>(this->Resolution[0] + this->Resolution[1] + this->Resolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(Enums::Sparse, this->Resolution, StorageResolution, Offsets.GetData());
+
+		this->Root.Set(Enums::Host, Vec<int, 1>((int)Root.size()), Root.data());
+		this->Nodes.Set(Enums::Host, Vec<int, 1>((int)Nodes.size()), Nodes.data());
+		this->Leaves.Set(Enums::Host, Leaves.GetResolution(), Leaves.GetData());
+		this->Offsets.Set(Enums::Host, Offsets.GetResolution(), Offsets.GetData());
+
+		// Until the tree is classified the background is considered visible
+		float BackgroundOpacity = FLT_MAX;
+
+		this->BackgroundOpacity.Set(Enums::Host, Vec<int, 1>(1), &BackgroundOpacity);
+	}
+
+	/*! Releases the sparse voxels */
+	HOST void Free()
+	{
+		this->Resolution = Vec3i();
+
+		this->Root.Free();
+		this->Nodes.Free();
+		this->Leaves.Free();
+		this->Offsets.Free();
+		this->BackgroundOpacity.Free();
+	}
+
+	/*! Sets the world space placement of the voxels
+		@param[in] BoundingBox Bounding box of the volume
+	*/
+	HOST void SetGeometry(const BoundingBox& BoundingBox)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			this->VoxelSize[i]		= this->Resolution[i] > 0 ? BoundingBox.GetSize()[i] / (float)this->Resolution[i] : 1.0f;
+			this->InvVoxelSize[i]	= 1.0f / this->VoxelSize[i];
+		}
+
+		this->MinP = BoundingBox.GetMinP();
+	}
+
+	/*! Evaluates the opacity of the background under the opacity transfer function \a Opacity, empty children are only skipped when it is zero
+		@param[in] Opacity Opacity transfer function
+	*/
+	HOST void Classify(const ScalarTransferFunction1D& Opacity)
+	{
+		if (!this->GetEnabled())
+			return;
+
+		float BackgroundOpacity = Opacity.Evaluate((float)this->Background);
+
+		this->BackgroundOpacity.Set(Enums::Host, Vec<int, 1>(1), &BackgroundOpacity);
+	}
+
+	/*! Gets whether a sparse voxel tree has been built
+		@return Whether voxels can be sampled
+	*/
+	HOST_DEVICE bool GetEnabled() const
+	{
+		return this->Root.GetNoElements() > 0;
+	}
+
+	/*! Gets the size of the sparse voxel tree
+		@return Size in bytes
+	*/
+	HOST long long GetNoBytes() const
+	{
+		return (long long)this->Root.GetNoBytes() + this->Nodes.GetNoBytes() + this->Leaves.GetNoBytes() + this->Offsets.GetNoBytes();
+	}
+
+	/*! Gets a fixed point trilinear sampler which reads through the tree
+		@return Voxel sampler
+	*/
+	HOST_DEVICE SparseVoxelSampler GetSampler() const
+	{
+		return SparseVoxelSampler(SparseVoxelReader(this->Root.GetData(), this->Nodes.GetData(), this->Leaves.GetData(), this->Background), this->Offsets.GetData(), this->Resolution);
+	}
+
+	/*! Advances the next sample of a ray over empty internal nodes and leaves, the largest empty child around the sample is stepped over at once
+		@param[in] O Ray origin
+		@param[in] D Ray direction
+		@param[in,out] T Parametric distance of the next sample, stays on the sampling lattice
+		@param[in] StepSize Step size
+		@param[in] MaxT Maximum parametric distance
+		@return Whether \a T was advanced
+	*/
+	HOST_DEVICE bool Skip(const Vec3f& O, const Vec3f& D, float& T, const float& StepSize, const float& MaxT) const
+	{
+		if (!this->GetEnabled() || this->BackgroundOpacity.GetData()[0] > 0.0f)
+			return false;
+
+		const Vec3i NoLeaves((this->Resolution[0] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE, (this->Resolution[1] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE, (this->Resolution[2] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE);
+		const int NoNodesX = (NoLeaves[0] + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE;
+		const int NoNodesY = (NoLeaves[1] + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE;
+
+		float EntryT = T;
+
+		while (EntryT < MaxT)
+		{
+			const Vec3f P = O + D * EntryT;
+
+			// Lower corner of the cell trilinear samples at P interpolate, clamped like the voxel sampler does
+			int Base[3], MaxBase[3];
+
+			for (int i = 0; i < 3; i++)
+			{
+				MaxBase[i]	= max(this->Resolution[i] - 2, 0);
+				Base[i]		= min((int)min(max((P[i] - this->MinP[i]) * this->InvVoxelSize[i] - 0.5f, 0.0f), (float)(this->Resolution[i] - 1)), MaxBase[i]);
+			}
+
+			const int Node = this->Root.GetData()[((Base[2] >> (VOXEL_BRICK_SIZE_LOG2 + SPARSE_NODE_SIZE_LOG2)) * NoNodesY + (Base[1] >> (VOXEL_BRICK_SIZE_LOG2 + SPARSE_NODE_SIZE_LOG2))) * NoNodesX + (Base[0] >> (VOXEL_BRICK_SIZE_LOG2 + SPARSE_NODE_SIZE_LOG2))];
+
+			int SizeLog2 = VOXEL_BRICK_SIZE_LOG2 + SPARSE_NODE_SIZE_LOG2;
+
+			if (Node != SPARSE_EMPTY)
+			{
+				if (Node < 0)
+					break;
+
+				const int Child = (((Base[2] >> VOXEL_BRICK_SIZE_LOG2) & (SPARSE_NODE_SIZE - 1)) * SPARSE_NODE_SIZE + ((Base[1] >> VOXEL_BRICK_SIZE_LOG2) & (SPARSE_NODE_SIZE - 1))) * SPARSE_NODE_SIZE + ((Base[0] >> VOXEL_BRICK_SIZE_LOG2) & (SPARSE_NODE_SIZE - 1));
+
+				if (this->Nodes.GetData()[(Node << (3 * SPARSE_NODE_SIZE_LOG2)) + Child] != SPARSE_EMPTY)
+					break;
+
+				SizeLog2 = VOXEL_BRICK_SIZE_LOG2;
+			}
+
+			// Leave the region of cells of the empty child, the outermost children extend to infinity because of the clamping
+			float ExitT = MaxT;
+
+			for (int i = 0; i < 3; i++)
+			{
+				const int Child		= Base[i] >> SizeLog2;
+				const int MaxChild	= MaxBase[i] >> SizeLog2;
+
+				int Boundary = 0;
+
+				if (D[i] > 0.0f && Child < MaxChild)
+					Boundary = (Child + 1) << SizeLog2;
+				else if (D[i] < 0.0f && Child > 0)
+					Boundary = Child << SizeLog2;
+				else
+					continue;
+
+				ExitT = min(ExitT, (this->MinP[i] + ((float)Boundary + 0.5f) * this->VoxelSize[i] - O[i]) / D[i]);
+			}
+
+			EntryT = max(ExitT, EntryT) + 0.001f * StepSize;
+		}
+
+		if (EntryT <= T)
+			return false;
+
+		T += ceilf((EntryT - T) / StepSize) * StepSize;
+
+		return true;
+	}
+
+protected:
+	Vec3i							Resolution;				/*! Resolution of the volume */
+	unsigned short					Background;				/*! Value of the voxels which are not stored, the minimum of the volume */
+	Vec3f							MinP;					/*! Minimum corner of the volume in world space */
+	Vec3f							VoxelSize;				/*! Voxel size in world space */
+	Vec3f							InvVoxelSize;			/*! Inverse voxel size in world space */
+	Buffer1D<int>					Root;					/*! Internal node index per root grid cell, or SPARSE_INACTIVE or SPARSE_EMPTY */
+	Buffer1D<int>					Nodes;					/*! Leaf index per child of all internal nodes, or SPARSE_INACTIVE or SPARSE_EMPTY */
+	Buffer1D<unsigned short>		Leaves;					/*! Voxels of all stored leaves, Morton ordered within a leaf */
+	Buffer1D<int>					Offsets;				/*! Offset tables of the sparse voxel layout */
+	Buffer1D<float>					BackgroundOpacity;		/*! Opacity of the background under the current opacity transfer function */
+};
+
+}
@@ -0,0 +1,302 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "defines.h"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace ExposureRender
+{
+
+namespace Cpu
+{
+
+/*! \class ThreadPool
+ * \brief Pool of persistent worker threads which executes a range of tasks in parallel, idle workers steal work from busy ones
+ */
+class ThreadPool
+{
+public:
+	/*! Constructor
+		@param[in] NoThreads Number of threads, including the calling thread (zero means one per hardware thread)
+	*/
+	HOST ThreadPool(const int& NoThreads = 0) :
+		Workers(),
+		Queues(),
+		Mutex(),
+		Start(),
+		Finished(),
+		Task(),
+		Generation(0),
+		NoBusy(0),
+		Stop(false),
+		Error()
+	{
+		const int NoHardwareThreads = (int)std::thread::hardware_concurrency();
+
+		const int Size = NoThreads > 0 ? NoThreads : max(NoHardwareThreads, 1);
+
+		this->Queues = std::vector<Queue>(Size);
+
+		for (int i = 1; i < Size; i++)
+			this->Workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+	}
+
+	/*! Destructor */
+	HOST ~ThreadPool()
+	{
+		{
+			std::unique_lock<std::mutex> Lock(this->Mutex);
+			this->Stop = true;
+		}
+
+		this->Start.notify_all();
+
+		for (size_t i = 0; i < this->Workers.size(); i++)
+			this->Workers[i].join();
+	}
+
+	/*! Executes \a Task for each task ID in [0, \a NoTasks) and returns when all tasks are done
+		@param[in] NoTasks Number of tasks
+		@param[in] Task Task function, receives the task ID
+	*/
+	HOST void Run(const int& NoTasks, const std::function<void(int)>& Task)
+	{
+		if (NoTasks <= 0)
+			return;
+
+		// Nested invocations (or a single thread) execute serially on the calling thread
+		if (ThreadPool::IsWorker() || this->Queues.size() == 1 || NoTasks == 1)
+		{
+			for (int i = 0; i < NoTasks; i++)
+				Task(i);
+
+			return;
+		}
+
+		std::unique_lock<std::mutex> Lock(this->Mutex);
+
+		// Hand out contiguous ranges, so that neighbouring tiles end up on the same thread
+		const int NoQueues = (int)this->Queues.size();
+
+		for (int i = 0; i < NoQueues; i++)
+		{
+			std::unique_lock<std::mutex> QueueLock(this->Queues[i].Mutex);
+
+			this->Queues[i].Begin	= (int)(((long long)NoTasks * i) / NoQueues);
+			this->Queues[i].End		= (int)(((long long)NoTasks * (i + 1)) / NoQueues);
+		}
+
+		this->Task		= Task;
+		this->NoBusy	= NoQueues - 1;
+		this->Error		= std::exception_ptr();
+		this->Generation++;
+
+		Lock.unlock();
+
+		this->Start.notify_all();
+
+		this->Execute(0);
+
+		Lock.lock();
+
+		this->Finished.wait(Lock, [this]() { return this->NoBusy == 0; });
+
+		this->Task = std::function<void(int)>();
+
+		if (this->Error)
+			std::rethrow_exception(this->Error);
+	}
+
+	/*! Gets the number of threads, including the calling thread
+		@return Number of threads
+	*/
+	HOST int GetNoThreads() const
+	{
+		return (int)this->Queues.size();
+	}
+
+	/*! Gets the global thread pool
+		@return Thread pool shared by the CPU render backend and host side preprocessing
+	*/
+	HOST static ThreadPool& Get()
+	{
+		static ThreadPool Instance;
+		return Instance;
+	}
+
+protected:
+	/*! Range of task IDs owned by a thread */
+	struct Queue
+	{
+		Queue() : Mutex(), Begin(0), End(0) {}
+		Queue(const Queue& Other) : Mutex(), Begin(Other.Begin), End(Other.End) {}
+
+		std::mutex	Mutex;		/*! Protects the range */
+		int			Begin;		/*! First task ID */
+		int			End;		/*! One past the last task ID */
+	};
+
+	/*! Whether the calling thread is executing a task
+		@return Reference to the thread local flag
+	*/
+	HOST static bool& IsWorker()
+	{
+#ifdef _MSC_VER
+		static __declspec(thread) bool Flag = false;
+#else
+		static thread_local bool Flag = false;
+#endif
+		return Flag;
+	}
+
+	/*! Worker thread main loop
+		@param[in] ID Worker ID
+	*/
+	HOST void WorkerLoop(const int ID)
+	{
+		int LastGeneration = 0;
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(this->Mutex);
+
+				this->Start.wait(Lock, [&]() { return this->Stop || this->Generation != LastGeneration; });
+
+				if (this->Stop)
+					return;
+
+				LastGeneration = this->Generation;
+			}
+
+			this->Execute(ID);
+
+			{
+				std::unique_lock<std::mutex> Lock(this->Mutex);
+
+				this->NoBusy--;
+
+				if (this->NoBusy == 0)
+					this->Finished.notify_all();
+			}
+		}
+	}
+
+	/*! Pops a task from the front of the thread's own range
+		@param[in] ID Worker ID
+		@param[out] TaskID Task ID
+		@return Whether a task was obtained
+	*/
+	HOST bool Pop(const int& ID, int& TaskID)
+	{
+		std::unique_lock<std::mutex> Lock(this->Queues[ID].Mutex);
+
+		if (this->Queues[ID].Begin >= this->Queues[ID].End)
+			return false;
+
+		TaskID = this->Queues[ID].Begin++;
+
+		return true;
+	}
+
+	/*! Steals the back half of the range of another thread
+		@param[in] ID Worker ID of the thief
+		@return Whether work was stolen
+	*/
+	HOST bool Steal(const int& ID)
+	{
+		const int NoQueues = (int)this->Queues.size();
+
+		for (int i = 1; i < NoQueues; i++)
+		{
+			Queue& Victim = this->Queues[(ID + i) % NoQueues];
+
+			int Begin = 0, End = 0;
+
+			{
+				std::unique_lock<std::mutex> Lock(Victim.Mutex);
+
+				const int NoRemaining = Victim.End - Victim.Begin;
+
+				if (NoRemaining <= 0)
+					continue;
+
+				End			= Victim.End;
+				Begin		= Victim.End - max(NoRemaining / 2, 1);
+				Victim.End	= Begin;
+			}
+
+			std::unique_lock<std::mutex> Lock(this->Queues[ID].Mutex);
+
+			this->Queues[ID].Begin	= Begin;
+			this->Queues[ID].End	= End;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	/*! Executes tasks until no work is left anywhere
+		@param[in] ID Worker ID
+	*/
+	HOST void Execute(const int& ID)
+	{
+		ThreadPool::IsWorker() = true;
+
+		int TaskID = 0;
+
+		while (this->Pop(ID, TaskID) || (this->Steal(ID) && this->Pop(ID, TaskID)))
+		{
+			try
+			{
+				this->Task(TaskID);
+			}
+			catch (...)
+			{
+				std::unique_lock<std::mutex> Lock(this->Mutex);
+
+				if (!this->Error)
+					this->Error = std::current_exception();
+			}
+		}
+
+		ThreadPool::IsWorker() = false;
+	}
+
+	std::vector<std::thread>		Workers;		/*! Worker threads */
+	std::vector<Queue>				Queues;			/*! Task ranges, one per thread */
+	std::mutex						Mutex;			/*! Protects the job state */
+	std::condition_variable			Start;			/*! Signals workers that a job is available */
+	std::condition_variable			Finished;		/*! Signals the caller that all workers are done */
+	std::function<void(int)>		Task;			/*! Current task function */
+	int								Generation;		/*! Job counter */
+	int								NoBusy;			/*! Number of workers still executing the current job */
+	bool							Stop;			/*! Whether workers should exit */
+	std::exception_ptr				Error;			/*! First exception thrown by a task */
+};
+
+}
+
+}
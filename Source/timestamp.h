@@ -1,98 +1,98 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "defines.h"
-#include "enums.h"
-
-namespace ExposureRender
-{
-
-/*! Timestamp class */
-class EXPOSURE_RENDER_DLL TimeStamp
-{
-public:
-	/*! Default constructor */
-	HOST_DEVICE TimeStamp() :
-		ModifiedTime(0)
-	{
-	}
-	
-	/*! Assignment operator
-		@param[in] Other Timestamp to copy
-		@return Copied Timestamp
-	*/
-	HOST_DEVICE TimeStamp& operator = (const TimeStamp& Other)
-	{
-		this->ModifiedTime = Other.ModifiedTime;
-
-		return *this;
-	}
-	
-	/*! Flag timestamp as modified */
-	HOST_DEVICE virtual void Modified()
-	{
-		this->ModifiedTime++;
-	}
-
-	/*! Get time when last modified */
-	HOST_DEVICE unsigned long GetModifiedTime()
-	{
-		return this->ModifiedTime;
-	}
-	
-	/*! Test whether \a Other timestamp is older than this
-		@param[in] Other Timestamp to test against
-		@return Whether \a Other is older
-	*/
-	HOST_DEVICE bool operator > (const TimeStamp& Other)
-	{
-		return this->ModifiedTime > Other.ModifiedTime;
-	};
-	
-	/*! Test whether \a Other timestamp is younger than this
-		@param[in] Other Timestamp to test against
-		@return Whether \a Other is younger
-	*/
-	HOST_DEVICE bool operator < (const TimeStamp& Other)
-	{
-		return this->ModifiedTime < Other.ModifiedTime;
-	};
-	
-	/*! Test whether \a Other timestamp is equal to this
-		@param[in] Other Timestamp to test against
-		@return Whether \a Other is equal to this
-	*/
-	HOST_DEVICE bool operator == (const TimeStamp& Other)
-	{
-		return this->ModifiedTime == Other.ModifiedTime;
-	};
-	
-	/*! Test whether \a Other timestamp is not equal to this
-		@param[in] Other Timestamp to test against
-		@return Whether \a Other is not equal to this
-	*/
-	HOST_DEVICE bool operator != (const TimeStamp& Other)
-	{
-		return this->ModifiedTime != Other.ModifiedTime;
-	};
-
-protected:
-	unsigned long	ModifiedTime;		/*! Last modified time */
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "defines.h"
+#include "enums.h"
+
+namespace ExposureRender
+{
+
+/*! Timestamp class */
+class EXPOSURE_RENDER_DLL TimeStamp
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE TimeStamp() :
+		ModifiedTime(0)
+	{
+	}
+	
+	/*! Assignment operator
+		@param[in] Other Timestamp to copy
+		@return Copied Timestamp
+	*/
+	HOST_DEVICE TimeStamp& operator = (const TimeStamp& Other)
+	{
+		this->ModifiedTime = Other.ModifiedTime;
+
+		return *this;
+	}
+	
+	/*! Flag timestamp as modified */
+	HOST_DEVICE virtual void Modified()
+	{
+		this->ModifiedTime++;
+	}
+
+	/*! Get time when last modified */
+	HOST_DEVICE unsigned long GetModifiedTime()
+	{
+		return this->ModifiedTime;
+	}
+	
+	/*! Test whether \a Other timestamp is older than this
+		@param[in] Other Timestamp to test against
+		@return Whether \a Other is older
+	*/
+	HOST_DEVICE bool operator > (const TimeStamp& Other)
+	{
+		return this->ModifiedTime > Other.ModifiedTime;
+	};
+	
+	/*! Test whether \a Other timestamp is younger than this
+		@param[in] Other Timestamp to test against
+		@return Whether \a Other is younger
+	*/
+	HOST_DEVICE bool operator < (const TimeStamp& Other)
+	{
+		return this->ModifiedTime < Other.ModifiedTime;
+	};
+	
+	/*! Test whether \a Other timestamp is equal to this
+		@param[in] Other Timestamp to test against
+		@return Whether \a Other is equal to this
+	*/
+	HOST_DEVICE bool operator == (const TimeStamp& Other)
+	{
+		return this->ModifiedTime == Other.ModifiedTime;
+	};
+	
+	/*! Test whether \a Other timestamp is not equal to this
+		@param[in] Other Timestamp to test against
+		@return Whether \a Other is not equal to this
+	*/
+	HOST_DEVICE bool operator != (const TimeStamp& Other)
+	{
+		return this->ModifiedTime != Other.ModifiedTime;
+	};
+
+protected:
+	unsigned long	ModifiedTime;		/*! Last modified time */
+};
+
+}
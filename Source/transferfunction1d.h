@@ -1,109 +1,231 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "transferfunction.h"
-#include "piecewiselinearfunction.h"
-#include "cudatexture1d.h"
-#include "color.h"
-
-namespace ExposureRender
-{
-
-/*! \class TransferFunction1D
- * \brief One-dimensional transfer function base template class
- */
-template<class T>
-class EXPOSURE_RENDER_DLL TransferFunction1D : public TransferFunction
-{
-public:
-	/*! Default constructor */
-	HOST_DEVICE TransferFunction1D() :
-		TransferFunction("Untitled"),
-		PLF("Untitled")
-	{
-	}
-
-	/*! Constructor
-		@param[in] Name Name
-	*/
-	HOST_DEVICE TransferFunction1D(const char* Name) :
-		TransferFunction(Name),
-		PLF(Name)
-	{
-	}
-	
-	/*! Copy constructor
-		@param[in] Other Transfer function to copy
-	*/
-	HOST_DEVICE TransferFunction1D(const TransferFunction1D& Other) :
-		TransferFunction("Untitled"),
-		PLF("Untitled")
-	{
-		*this = Other;
-	}
-
-	/*! Destructor */
-	HOST_DEVICE virtual ~TransferFunction1D(void)
-	{
-	}
-	
-	/*! Assignment operator
-		@param[in] Other Transfer function to copy
-		@return Reference to the copied transfer function
-	*/
-	HOST_DEVICE TransferFunction1D& operator = (const TransferFunction1D& Other)
-	{
-		TransferFunction::operator = (Other);
-		
-		this->PLF = Other.PLF;
-		
-		return *this;
-	}
-
-	/*! Adds a node with \a Position and \a Value
-		@param[in] Position Position of the node
-		@param[in] Value Value of the node
-	*/
-	HOST_DEVICE void AddNode(const float& Position, const T& Value)
-	{
-		this->PLF.AddNode(Position, Value);
-	}
-
-	/*! Resets the content of the piecewise linear function */
-	HOST_DEVICE void Reset()
-	{
-		this->PLF.Reset();
-	}
-	
-	/*! Evaluates the transfer function at \a Position
-		@param[in] Position Position to evaluate
-		@return Value at \a Position
-	*/
-	HOST_DEVICE T Evaluate(const float& Position) const
-	{
-		return this->PLF.Evaluate(Position);
-	}
-
-protected:
-	PiecewiseLinearFunction<T>		PLF;			/*! Piecewise linear function */
-};
-
-typedef TransferFunction1D<float>		ScalarTransferFunction1D;
-typedef TransferFunction1D<ColorXYZf>	ColorTransferFunction1D;
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "transferfunction.h"
+#include "piecewiselinearfunction.h"
+#include "cudatexture1d.h"
+#include "color.h"
+
+namespace ExposureRender
+{
+
+/*! Gets channel \a Channel of a scalar transfer function value */
+HOST_DEVICE inline float GetChannel(const float& Value, const int& Channel)
+{
+	return Value;
+}
+
+/*! Gets channel \a Channel of a color transfer function value */
+HOST_DEVICE inline float GetChannel(const ColorXYZf& Value, const int& Channel)
+{
+	return Value[Channel];
+}
+
+/*! Sets channel \a Channel of a scalar transfer function value */
+HOST_DEVICE inline void SetChannel(float& Value, const int& Channel, const float& ChannelValue)
+{
+	Value = ChannelValue;
+}
+
+/*! Sets channel \a Channel of a color transfer function value */
+HOST_DEVICE inline void SetChannel(ColorXYZf& Value, const int& Channel, const float& ChannelValue)
+{
+	Value[Channel] = ChannelValue;
+}
+
+/*! \class TransferFunction1D
+ * \brief One-dimensional transfer function base template class, the piecewise linear function is baked into a lookup table (one array per channel) which makes evaluation independent of the number of nodes
+ */
+template<class T>
+class EXPOSURE_RENDER_DLL TransferFunction1D : public TransferFunction
+{
+public:
+	/*! Default constructor */
+	HOST_DEVICE TransferFunction1D() :
+		TransferFunction("Untitled"),
+		PLF("Untitled"),
+		Baked(false),
+		LUTMin(0.0f),
+		LUTScale(0.0f)
+	{
+	}
+
+	/*! Constructor
+		@param[in] Name Name
+	*/
+	HOST_DEVICE TransferFunction1D(const char* Name) :
+		TransferFunction(Name),
+		PLF(Name),
+		Baked(false),
+		LUTMin(0.0f),
+		LUTScale(0.0f)
+	{
+	}
+	
+	/*! Copy constructor
+		@param[in] Other Transfer function to copy
+	*/
+	HOST_DEVICE TransferFunction1D(const TransferFunction1D& Other) :
+		TransferFunction("Untitled"),
+		PLF("Untitled"),
+		Baked(false),
+		LUTMin(0.0f),
+		LUTScale(0.0f)
+	{
+		*this = Other;
+	}
+
+	/*! Destructor */
+	HOST_DEVICE virtual ~TransferFunction1D(void)
+	{
+	}
+	
+	/*! Assignment operator, the copy is always baked
+		@param[in] Other Transfer function to copy
+		@return Reference to the copied transfer function
+	*/
+	HOST_DEVICE TransferFunction1D& operator = (const TransferFunction1D& Other)
+	{
+		TransferFunction::operator = (Other);
+		
+		this->PLF = Other.PLF;
+
+		if (Other.Baked)
+		{
+			for (int c = 0; c < NoChannels; c++)
+				for (int i = 0; i < TF_TEXTURE_RESOLUTION; i++)
+					this->LUT[c][i] = Other.LUT[c][i];
+
+			this->LUTMin	= Other.LUTMin;
+			this->LUTScale	= Other.LUTScale;
+			this->Baked		= true;
+		}
+		else
+		{
+			this->Bake();
+		}
+		
+		return *this;
+	}
+
+	/*! Adds a node with \a Position and \a Value
+		@param[in] Position Position of the node
+		@param[in] Value Value of the node
+	*/
+	HOST_DEVICE void AddNode(const float& Position, const T& Value)
+	{
+		this->PLF.AddNode(Position, Value);
+
+		this->Baked = false;
+
+		this->Modified();
+	}
+
+	/*! Resets the content of the piecewise linear function */
+	HOST_DEVICE void Reset()
+	{
+		this->PLF.Reset();
+
+		this->Baked = false;
+
+		this->Modified();
+	}
+
+	/*! Gets the range spanned by the nodes, outside of it the transfer function is constant
+		@return Node range
+	*/
+	HOST_DEVICE Vec2f GetNodeRange() const
+	{
+		return this->PLF.GetCount() > 0 ? this->PLF.GetNodeRange() : Vec2f(0.0f);
+	}
+
+	/*! Tests whether \a Other has the same nodes, unlike time stamps this holds across copies of a transfer function that were modified separately
+		@param[in] Other Transfer function to compare with
+		@return Whether the nodes are equal
+	*/
+	HOST_DEVICE bool HasSameNodes(const TransferFunction1D& Other) const
+	{
+		return this->PLF.HasSameNodes(Other.PLF);
+	}
+
+	/*! Maps the node positions linearly and bakes the lookup table again, see PiecewiseFunction::MapNodePositions
+		@param[in] Scale Scale, positive so that the nodes keep their order
+		@param[in] Offset Offset
+	*/
+	HOST_DEVICE void MapNodePositions(const float& Scale, const float& Offset)
+	{
+		this->PLF.MapNodePositions(Scale, Offset);
+		this->Bake();
+	}
+
+	/*! Bakes the piecewise linear function into the lookup table, which spans the range of the nodes */
+	HOST_DEVICE void Bake()
+	{
+		const Vec2f NodeRange = this->PLF.GetNodeRange();
+
+		const float Range = NodeRange[1] - NodeRange[0];
+
+		this->LUTMin	= this->PLF.GetCount() > 0 ? NodeRange[0] : 0.0f;
+		this->LUTScale	= this->PLF.GetCount() > 0 && Range > 0.0f ? (float)(TF_TEXTURE_RESOLUTION - 1) / Range : 0.0f;
+
+		for (int i = 0; i < TF_TEXTURE_RESOLUTION; i++)
+		{
+			const T Value = this->PLF.Evaluate(this->LUTScale > 0.0f ? this->LUTMin + (float)i / this->LUTScale : this->LUTMin);
+
+			for (int c = 0; c < NoChannels; c++)
+				this->LUT[c][i] = GetChannel(Value, c);
+		}
+
+		this->Baked = true;
+	}
+	
+	/*! Evaluates the transfer function at \a Position, from the lookup table once the transfer function is baked
+		@param[in] Position Position to evaluate
+		@return Value at \a Position
+	*/
+	HOST_DEVICE T Evaluate(const float& Position) const
+	{
+		if (!this->Baked)
+			return this->PLF.Evaluate(Position);
+
+		const float U		= min(max((Position - this->LUTMin) * this->LUTScale, 0.0f), (float)(TF_TEXTURE_RESOLUTION - 1));
+		const int I			= min((int)U, TF_TEXTURE_RESOLUTION - 2);
+		const float LerpT	= U - (float)I;
+
+		T Value;
+
+		for (int c = 0; c < NoChannels; c++)
+			SetChannel(Value, c, this->LUT[c][I] + LerpT * (this->LUT[c][I + 1] - this->LUT[c][I]));
+
+		return Value;
+	}
+
+protected:
+	static const int NoChannels = sizeof(T) / sizeof(float);
+
+	PiecewiseLinearFunction<T>		PLF;									/*! Piecewise linear function */
+	bool							Baked;									/*! Whether the lookup table is up to date */
+	float							LUTMin;									/*! Position of the first lookup table entry */
+	float							LUTScale;								/*! Lookup table entries per unit position */
+	float							LUT[NoChannels][TF_TEXTURE_RESOLUTION];	/*! Lookup table, one array per channel */
+};
+
+typedef TransferFunction1D<float>		ScalarTransferFunction1D;
+typedef TransferFunction1D<ColorXYZf>	ColorTransferFunction1D;
+
+}
@@ -1,266 +1,789 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "hostvolume.h"
-#include "boundingbox.h"
-#include "octree.h"
-#include "cudatexture3d.h"
-#include "utilities.h"
-#include "transform.h"
-
-namespace ExposureRender
-{
-
-/*! Volume class */
-class Volume : public TimeStamp
-{
-public:
-	/*! Default constructor */
-	HOST Volume() :
-		TimeStamp(),
-		Transform(),
-		BoundingBox(),
-		Spacing(1.0f),
-		InvSpacing(1.0f),
-		Size(1.0f),
-		InvSize(1.0f),
-		MinStep(1.0f),
-		Voxels(),
-		AcceleratorType(Enums::Octree),
-		MaxGradientMagnitude(0.0f)
-	{
-	}
-	
-	/*! Copy constructor
-		@param[in] Other Volume to copy
-	*/
-	HOST Volume(const HostVolume& Other) :
-		TimeStamp(),
-		Transform(),
-		BoundingBox(),
-		Spacing(1.0f),
-		InvSpacing(1.0f),
-		Size(1.0f),
-		InvSize(1.0f),
-		MinStep(1.0f),
-		Voxels(),
-		AcceleratorType(Enums::Octree),
-		MaxGradientMagnitude(0.0f)
-	{
-		*this = Other;
-	}
-	
-	/*! Assignment operator
-		@param[in] Other Volume to copy
-		@return Copied volume
-	*/
-	HOST Volume& Volume::operator = (const HostVolume& Other)
-	{
-		TimeStamp::operator = (Other);
-
-		this->Transform			= Other.GetAlignment().GetTransform();
-		this->Voxels			= Other.Voxels;
-		this->AcceleratorType	= Other.GetAcceleratorType();
-
-		const int NoElements = this->Voxels.GetResolution().CumulativeProduct();
-
-		if (NoElements > 0)
-		{
-			float Scale = 0.0f;
-
-			if (Other.GetNormalizeSize())
-			{
-				const Vec3f PhysicalSize = Vec3f((float)this->Voxels.GetResolution()[0], (float)this->Voxels.GetResolution()[1], (float)this->Voxels.GetResolution()[2]) * Other.GetSpacing();
-				Scale = 1.0f / max(PhysicalSize[0], max(PhysicalSize[1], PhysicalSize[2]));
-			}
-
-			this->Spacing		= Scale * Other.GetSpacing();
-			this->InvSpacing	= 1.0f / this->Spacing;
-			this->Size			= Vec3f((float)this->Voxels.GetResolution()[0] * this->Spacing[0], (float)this->Voxels.GetResolution()[1] *this->Spacing[1], (float)this->Voxels.GetResolution()[2] * this->Spacing[2]);
-			this->InvSize		= 1.0f / this->Size;
-
-			this->BoundingBox.SetMinP(-0.5 * Size);
-			this->BoundingBox.SetMaxP(0.5f * Size);
-
-			this->MinStep = min(this->Spacing[0], min(this->Spacing[1], this->Spacing[2]));
-
-			this->MaxGradientMagnitude = Other.GetMaximumGradientMagnitude();
-		}
-
-		return *this;
-	}
-	
-	/*! Gets voxel data at \a XYZ
-		@param[in] XYZ Position
-		@param[in] TextureID CUDA texture ID
-		@return Data at \a XYZ volume
-	*/
-	DEVICE unsigned short operator()(const Vec3f& XYZ, const int& TextureID = 0)
-	{
-		const Vec3f NormalizedXYZ = (XYZ - this->BoundingBox.GetMinP()) * this->InvSize;
-		
-		switch (TextureID)
-		{
-			case 0: return (float)USHRT_MAX * tex3D(TexVolume0, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]); 
-			case 1: return (float)USHRT_MAX * tex3D(TexVolume1, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]); 
-		}
-
-		return 0;
-	}
-	
-	/*! Gets voxel data at (\a X,\a Y,\a Z)
-		@param[in] X Position
-		@param[in] Y Position
-		@param[in] Z Position
-		@return Data at \a X,\a Y,\a Z
-	*/
-	DEVICE unsigned short operator()(const int& X, const int& Y, const int& Z)
-	{
-		const Vec3f NormalizedXYZ((float)X / (float)Voxels.GetResolution()[0], (float)X / (float)Voxels.GetResolution()[1], (float)X / (float)Voxels.GetResolution()[2]);
-		
-		return (float)USHRT_MAX * tex3D(TexVolume0, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]);
-	}
-	
-	/*! Gets the voxel data at \a P
-		@param[in] P Position
-		@return Data at \a XYZ volume
-	*/
-	DEVICE unsigned short GetIntensity(const Vec3f& P)
-	{
-		return (*this)(P);
-	}
-	
-	/*! Computes the gradient at \a P using central differences
-		@param[in] P Position at which to compute the gradient
-		@return Gradient at \a P
-	*/
-	DEVICE Vec3f GradientCD(const Vec3f& P)
-	{
-		const float Intensity[3][2] = 
-		{
-			{ GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)), GetIntensity(P - Vec3f(this->Spacing[0], 0.0f, 0.0f)) },
-			{ GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)), GetIntensity(P - Vec3f(0.0f, this->Spacing[1], 0.0f)) },
-			{ GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2])), GetIntensity(P - Vec3f(0.0f, 0.0f, this->Spacing[2])) }
-		};
-
-		return Vec3f(Intensity[0][1] - Intensity[0][0], Intensity[1][1] - Intensity[1][0], Intensity[2][1] - Intensity[2][0]);
-	}
-	
-	/*! Computes the gradient at \a P using forward differences
-		@param[in] P Position at which to compute the gradient
-		@return Gradient at \a P
-	*/
-	DEVICE Vec3f GradientFD(const Vec3f& P)
-	{
-		const float Intensity[4] = 
-		{
-			GetIntensity(P),
-			GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)),
-			GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)),
-			GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2]))
-		};
-
-		return Vec3f(Intensity[0] - Intensity[1], Intensity[0] - Intensity[2], Intensity[0] - Intensity[3]);
-	}
-	
-	/*! Computes the filtered gradient at \a P using central differences
-		@param[in] P Position at which to compute the gradient
-		@return Gradient at \a P
-	*/
-	DEVICE Vec3f GradientFiltered(const Vec3f& P)
-	{
-		Vec3f Offset(Vec3f(this->Spacing[0], 0.0f, 0.0f)[0], Vec3f(0.0f, this->Spacing[1], 0.0f)[1], Vec3f(0.0f, 0.0f, this->Spacing[2])[2]);
-
-		const Vec3f G0 = GradientCD(P);
-		const Vec3f G1 = GradientCD(P + Vec3f(-Offset[0], -Offset[1], -Offset[2]));
-		const Vec3f G2 = GradientCD(P + Vec3f( Offset[0],  Offset[1],  Offset[2]));
-		const Vec3f G3 = GradientCD(P + Vec3f(-Offset[0],  Offset[1], -Offset[2]));
-		const Vec3f G4 = GradientCD(P + Vec3f( Offset[0], -Offset[1],  Offset[2]));
-		const Vec3f G5 = GradientCD(P + Vec3f(-Offset[0], -Offset[1],  Offset[2]));
-		const Vec3f G6 = GradientCD(P + Vec3f( Offset[0],  Offset[1], -Offset[2]));
-		const Vec3f G7 = GradientCD(P + Vec3f(-Offset[0],  Offset[1],  Offset[2]));
-		const Vec3f G8 = GradientCD(P + Vec3f( Offset[0], -Offset[1], -Offset[2]));
-	    
-		const Vec3f L0 = Lerp(0.5f, Lerp(0.5f, G1, G2), Lerp(0.5f, G3, G4));
-		const Vec3f L1 = Lerp(0.5f, Lerp(0.5f, G5, G6), Lerp(0.5f, G7, G8));
-	    
-		return Lerp(0.75f, G0, Lerp(0.5f, L0, L1));
-	}
-	
-	/*! Computes the gradient at \a P using \a GradientMode
-		@param[in] P Position at which to compute the gradient
-		@param[in] GradientMode Type of gradient computation
-		@return Gradient at \a P
-	*/
-	DEVICE Vec3f Gradient(const Vec3f& P, const Enums::GradientMode& GradientMode)
-	{
-		switch (GradientMode)
-		{
-			case Enums::ForwardDifferences:		return GradientFD(P);
-			case Enums::CentralDifferences:		return GradientCD(P);
-			case Enums::Filtered:				return GradientFiltered(P);
-		}
-
-		return GradientFD(P);
-	}
-	
-	/*! Computes the normalized gradient at \a P using \a GradientMode
-		@param[in] P Position at which to compute the gradient
-		@param[in] GradientMode Type of gradient computation
-		@return Gradient at \a P
-	*/
-	DEVICE Vec3f NormalizedGradient(const Vec3f& P, const Enums::GradientMode& GradientMode)
-	{
-		return Normalize(Gradient(P, GradientMode));
-	}
-	
-	/*! Computes the gradient magnitude at \a P
-		@param[in] P Position at which to compute the gradient magnitude
-		@return Gradient magnitude at \a P
-	*/
-	DEVICE float GradientMagnitude(const Vec3f& P)
-	{
-		const Vec3f HalfSpacing = 0.5f / this->Spacing;
-
-		float D = 0.0f, Sum = 0.0f;
-
-		D = (GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)) - GetIntensity(P - Vec3f(this->Spacing[0], 0.0f, 0.0f))) * 0.5f;
-		Sum += D * D;
-
-		D = (GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)) - GetIntensity(P - Vec3f(0.0f, this->Spacing[1], 0.0f))) * 0.5f;
-		Sum += D * D;
-
-		D = (GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2])) - GetIntensity(P - Vec3f(0.0f, 0.0f, this->Spacing[2]))) * 0.5f;
-		Sum += D * D;
-
-		return sqrtf(Sum);
-	}
-	
-	Transform						Transform;					/*! Transform of the volume */
-	BoundingBox						BoundingBox;				/*! Encompassing bounding box */
-	Vec3f							Spacing;					/*! Voxel spacing */
-	Vec3f							InvSpacing;					/*! Inverse voxel spacing */
-	Vec3f							Size;						/*! Volume size */
-	Vec3f							InvSize;					/*! Inverse volume size */
-	float							MinStep;					/*! Minimum step size */
-	CudaTexture3D<unsigned short>	Voxels;						/*! Voxel 3D buffer */
-	Enums::AcceleratorType			AcceleratorType;			/*! Type of ray traversal accelerator */
-	float							MaxGradientMagnitude;		/*! Maximum gradient magnitude */
-};
-
-}
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "hostvolume.h"
+#include "boundingbox.h"
+#include "octree.h"
+#include "cudatexture3d.h"
+#include "buffer3d.h"
+#include "buffer1d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "macrocellgrid.h"
+#include "gradientvolume.h"
+#include "volumecache.h"
+#include "brickcache.h"
+#include "volumepyramid.h"
+#include "compressedvoxels.h"
+#include "sparsevoxels.h"
+#include "quantizedvoxels.h"
+#include "classifiedvoxels.h"
+#include "utilities.h"
+#include "transform.h"
+
+namespace ExposureRender
+{
+
+/*! Volume class */
+class Volume : public TimeStamp
+{
+public:
+	/*! Default constructor */
+	HOST Volume() :
+		TimeStamp(),
+		Transform(),
+		BoundingBox(),
+		Spacing(1.0f),
+		InvSpacing(1.0f),
+		Size(1.0f),
+		InvSize(1.0f),
+		MinStep(1.0f),
+#ifdef ER_CPU
+		Voxels("Device Voxels", Enums::Device),
+		NativeVoxels("Device Native Voxels", Enums::Device),
+		VoxelType(Enums::UnsignedShort),
+		NativeMin(0.0f),
+		NativeScale(1.0f),
+		Resolution(),
+		VoxelLayout(Enums::Scanline),
+		VoxelOffsets("Device Voxel Offsets", Enums::Device),
+		Bricks(),
+		Compressed(),
+		Sparse(),
+		Quantized(),
+		QuantizedTimeStamp(),
+		Classified(),
+		Pyramid(),
+#else
+		Voxels(),
+#endif
+		AcceleratorType(Enums::MacrocellGrid),
+		Macrocells(),
+		Octree(),
+		Gradients(),
+		Histogram("Histogram", Enums::Host),
+		PreprocessedVoxels(),
+		MaxGradientMagnitude(0.0f),
+		ClassifiedOpacity(),
+		ClassificationStale(true)
+	{
+	}
+	
+	/*! Copy constructor
+		@param[in] Other Volume to copy
+	*/
+	HOST Volume(const HostVolume& Other) :
+		TimeStamp(),
+		Transform(),
+		BoundingBox(),
+		Spacing(1.0f),
+		InvSpacing(1.0f),
+		Size(1.0f),
+		InvSize(1.0f),
+		MinStep(1.0f),
+#ifdef ER_CPU
+		Voxels("Device Voxels", Enums::Device),
+		NativeVoxels("Device Native Voxels", Enums::Device),
+		VoxelType(Enums::UnsignedShort),
+		NativeMin(0.0f),
+		NativeScale(1.0f),
+		Resolution(),
+		VoxelLayout(Enums::Scanline),
+		VoxelOffsets("Device Voxel Offsets", Enums::Device),
+		Bricks(),
+		Compressed(),
+		Sparse(),
+		Quantized(),
+		QuantizedTimeStamp(),
+		Classified(),
+		Pyramid(),
+#else
+		Voxels(),
+#endif
+		AcceleratorType(Enums::MacrocellGrid),
+		Macrocells(),
+		Octree(),
+		Gradients(),
+		Histogram("Histogram", Enums::Host),
+		PreprocessedVoxels(),
+		MaxGradientMagnitude(0.0f),
+		ClassifiedOpacity(),
+		ClassificationStale(true)
+	{
+		*this = Other;
+	}
+	
+	/*! Assignment operator
+		@param[in] Other Volume to copy
+		@return Copied volume
+	*/
+	HOST Volume& operator = (const HostVolume& Other)
+	{
+		TimeStamp::operator = (Other);
+
+		this->Transform			= Other.GetAlignment().GetTransform();
+#ifdef ER_CPU
+		this->SetVoxels(Other);
+#else
+		if (Other.GetVoxelType() != Enums::UnsignedShort)
+			throw(Exception(Enums::Error, "The CUDA renderer only supports unsigned short voxels"));
+
+		this->Voxels			= Other.Voxels;
+#endif
+		this->AcceleratorType	= Other.GetAcceleratorType();
+
+		const Vec3i Resolution = Other.GetResolution();
+
+		const long long NoElements = Resolution.LongCumulativeProduct();
+
+		if (NoElements > 0)
+		{
+			float Scale = 0.0f;
+
+			if (Other.GetNormalizeSize())
+			{
+				const Vec3f PhysicalSize = Vec3f((float)Resolution[0], (float)Resolution[1], (float)Resolution[2]) * Other.GetSpacing();
+				Scale = 1.0f / max(PhysicalSize[0], max(PhysicalSize[1], PhysicalSize[2]));
+			}
+
+			this->Spacing		= Scale * Other.GetSpacing();
+			this->InvSpacing	= 1.0f / this->Spacing;
+			this->Size			= Vec3f((float)Resolution[0] * this->Spacing[0], (float)Resolution[1] *this->Spacing[1], (float)Resolution[2] * this->Spacing[2]);
+			this->InvSize		= 1.0f / this->Size;
+
+			this->BoundingBox.SetMinP(-0.5 * Size);
+			this->BoundingBox.SetMaxP(0.5f * Size);
+
+			this->MinStep = min(this->Spacing[0], min(this->Spacing[1], this->Spacing[2]));
+
+			this->Preprocess(Other);
+
+#ifdef ER_CPU
+			// Streamed volumes have no pyramid, it would hold an eighth of the voxels in memory and the brick cache already falls back to its coarse copy
+			this->Pyramid.Build(Other.GetVoxelSource(), Other.GetVoxelsTimeStamp(), this->Bricks.GetEnabled() ? 1 : Other.GetNoLevels());
+#endif
+		}
+
+		return *this;
+	}
+	
+	/*! Gets voxel data at \a XYZ
+		@param[in] XYZ Position
+		@param[in] TextureID CUDA texture ID
+		@return Data at \a XYZ volume
+	*/
+	DEVICE unsigned short operator()(const Vec3f& XYZ, const int& TextureID = 0)
+	{
+		const Vec3f NormalizedXYZ = (XYZ - this->BoundingBox.GetMinP()) * this->InvSize;
+		
+#ifdef ER_CPU
+		return this->Fetch(NormalizedXYZ);
+#else
+		switch (TextureID)
+		{
+			case 0: return (float)USHRT_MAX * tex3D(TexVolume0, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]); 
+			case 1: return (float)USHRT_MAX * tex3D(TexVolume1, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]); 
+		}
+
+		return 0;
+#endif
+	}
+	
+	/*! Gets voxel data at (\a X,\a Y,\a Z)
+		@param[in] X Position
+		@param[in] Y Position
+		@param[in] Z Position
+		@return Data at \a X,\a Y,\a Z
+	*/
+	DEVICE unsigned short operator()(const int& X, const int& Y, const int& Z)
+	{
+		const Vec3f NormalizedXYZ((float)X / (float)Voxels.GetResolution()[0], (float)X / (float)Voxels.GetResolution()[1], (float)X / (float)Voxels.GetResolution()[2]);
+		
+#ifdef ER_CPU
+		return this->Fetch(NormalizedXYZ);
+#else
+		return (float)USHRT_MAX * tex3D(TexVolume0, NormalizedXYZ[0], NormalizedXYZ[1], NormalizedXYZ[2]);
+#endif
+	}
+
+#ifdef ER_CPU
+	/*! Fetches voxel data with the same semantics as the CUDA texture (voxel centered, clamped and filtered according to the voxel buffer's filter mode)
+		@param[in] NormalizedXYZ Normalized position
+		@return Data at \a NormalizedXYZ
+	*/
+	HOST_DEVICE float Fetch(const Vec3f& NormalizedXYZ) const
+	{
+		const Vec3f UVW = this->GetVoxelCoordinates(NormalizedXYZ);
+
+		// Samples of bricks which are not resident come from the coarse copy, which averages voxels beyond the macrocell, clamping keeps their opacity below the majorant like for pyramid samples
+		if (this->Bricks.GetEnabled())
+			return this->Macrocells.ClampIntensity(this->BoundingBox.GetMinP() + NormalizedXYZ * this->Size, this->Bricks.Fetch(UVW, this->Voxels.GetFilterMode() == Enums::NearestNeighbour));
+
+		return this->VisitSampler(FetchVisitor(UVW, this->Voxels.GetFilterMode() == Enums::NearestNeighbour));
+	}
+
+	/*! Calls \a Visitor with the sampler of the resident voxels, which are compressed, sparse, of a native voxel type or unsigned shorts
+		@param[in] Visitor Function object with a templated call operator which takes a BasicVoxelSampler
+		@return Result of \a Visitor
+	*/
+	template<class F>
+	HOST_DEVICE typename F::Result VisitSampler(const F& Visitor) const
+	{
+		if (this->Compressed.GetEnabled())
+			return Visitor(this->Compressed.GetSampler());
+
+		if (this->Sparse.GetEnabled())
+			return Visitor(this->Sparse.GetSampler());
+
+		switch (this->VoxelType)
+		{
+			case Enums::UnsignedChar:	return Visitor(this->GetNativeSampler<unsigned char>());
+			case Enums::Short:			return Visitor(this->GetNativeSampler<short>());
+			case Enums::Half:			return Visitor(this->GetNativeSampler<HalfFloat>());
+			case Enums::Float:			return Visitor(this->GetNativeSampler<float>());
+			default:					return Visitor(this->GetSampler());
+		}
+	}
+
+	/*! Converts normalized coordinates to voxel coordinates, in which voxel centers lie on integer coordinates
+		@param[in] NormalizedXYZ Normalized position
+		@return Voxel coordinates
+	*/
+	HOST_DEVICE Vec3f GetVoxelCoordinates(const Vec3f& NormalizedXYZ) const
+	{
+		const Vec3i& Resolution = this->Resolution;
+
+		return Vec3f(NormalizedXYZ[0] * (float)Resolution[0] - 0.5f, NormalizedXYZ[1] * (float)Resolution[1] - 0.5f, NormalizedXYZ[2] * (float)Resolution[2] - 0.5f);
+	}
+
+	/*! Gets a fixed point trilinear sampler for the voxels
+		@return Voxel sampler
+	*/
+	HOST_DEVICE VoxelSampler GetSampler() const
+	{
+		return VoxelSampler(this->Voxels.GetData(), this->VoxelOffsets.GetData(), this->Resolution);
+	}
+
+	/*! Gets a fixed point trilinear sampler for voxels of native type \a T, which maps them to intensities while sampling
+		@return Voxel sampler
+	*/
+	template<class T>
+	HOST_DEVICE BasicVoxelSampler<NativeVoxelReader<T> > GetNativeSampler() const
+	{
+		return BasicVoxelSampler<NativeVoxelReader<T> >(NativeVoxelReader<T>((const T*)this->NativeVoxels.GetData(), this->NativeMin, this->NativeScale), this->VoxelOffsets.GetData(), this->Resolution);
+	}
+
+	/*! Copies the voxels of \a Other and arranges them in its voxel layout (compressing them or building a sparse voxel tree for those layouts), or streams them through the brick cache when they exceed the streaming budget of \a Other. Voxels of the other voxel types keep their native width in the scanline and bricked layouts. Nothing is copied when neither the voxels, the layout nor the streaming budget changed
+		@param[in] Other Host volume to copy the voxels from
+	*/
+	HOST void SetVoxels(const HostVolume& Other)
+	{
+		bool Streamed = BrickCache::Required(Other);
+
+		if (Streamed && Other.Voxels.GetMemoryType() != Enums::External)
+		{
+			DebugLog("%s: only memory mapped voxels can be streamed, the voxels stay resident", __FUNCTION__);
+			Streamed = false;
+		}
+
+		const bool StreamingChanged = Streamed ? this->Bricks.GetBudget() != Other.GetStreamingBudget() : this->Bricks.GetEnabled();
+
+		if (this->Voxels.TimeStamp == Other.GetVoxelsTimeStamp() && this->VoxelType == Other.GetVoxelType() && this->VoxelLayout == Other.GetVoxelLayout() && !StreamingChanged)
+			return;
+
+		const VoxelSource Source = Other.GetVoxelSource();
+
+		// The voxels change, so the accelerators and the classified opacities have to be classified again
+		this->ClassificationStale = true;
+
+		this->Resolution	= Other.GetResolution();
+		this->VoxelLayout	= Other.GetVoxelLayout();
+		this->VoxelType		= Other.GetVoxelType();
+		this->NativeMin		= Other.GetVoxelRange()[0];
+		this->NativeScale	= GetIntensityScale(Other.GetVoxelRange()[0], Other.GetVoxelRange()[1]);
+
+		this->Voxels.SetFilterMode(Other.Voxels.GetFilterMode());
+		this->NativeVoxels.Free();
+
+		if (Streamed)
+		{
+			this->Voxels.Free();
+			this->VoxelOffsets.Free();
+			this->Compressed.Free();
+			this->Sparse.Free();
+
+			this->Bricks.Create(Other);
+
+			this->Voxels.TimeStamp = Other.GetVoxelsTimeStamp();
+			return;
+		}
+
+		this->Bricks.Free();
+
+		if (this->VoxelLayout == Enums::Compressed)
+		{
+			this->Voxels.Free();
+			this->VoxelOffsets.Free();
+
+			this->Sparse.Free();
+			this->Compressed.Set(Source);
+
+			this->Voxels.TimeStamp = Other.GetVoxelsTimeStamp();
+			return;
+		}
+
+		this->Compressed.Free();
+
+		if (this->VoxelLayout == Enums::Sparse)
+		{
+			this->Voxels.Free();
+			this->VoxelOffsets.Free();
+
+			this->Sparse.Set(Source);
+
+			this->Voxels.TimeStamp = Other.GetVoxelsTimeStamp();
+			return;
+		}
+
+		this->Sparse.Free();
+
+		Buffer1D<int> VoxelOffsets("Host Voxel Offsets", Enums::Host);
+
+		VoxelOffsets.Resize(Vec<int, 1>(this->Resolution[0] + this->Resolution[1] + this->Resolution[2]));
+
+		Vec3i StorageResolution;
+
+		ComputeVoxelOffsets(this->VoxelLayout, this->Resolution, StorageResolution, VoxelOffsets.GetData());
+
+		this->VoxelOffsets = VoxelOffsets;
+
+		if (this->VoxelType != Enums::UnsignedShort)
+		{
+			this->Voxels.Free();
+
+			const int VoxelSize = GetVoxelSize(this->VoxelType);
+
+			this->NativeVoxels.Resize(Vec3i(StorageResolution[0] * VoxelSize, StorageResolution[1], StorageResolution[2]));
+
+			switch (this->VoxelType)
+			{
+				case Enums::UnsignedChar:	ReorderVoxels((const unsigned char*)Source.GetBytes(), this->Resolution, VoxelOffsets.GetData(), (unsigned char*)this->NativeVoxels.GetData());	break;
+				case Enums::Float:			ReorderVoxels((const float*)Source.GetBytes(), this->Resolution, VoxelOffsets.GetData(), (float*)this->NativeVoxels.GetData());					break;
+				default:					ReorderVoxels((const short*)Source.GetBytes(), this->Resolution, VoxelOffsets.GetData(), (short*)this->NativeVoxels.GetData());					break;
+			}
+
+			this->Voxels.TimeStamp = Other.GetVoxelsTimeStamp();
+			return;
+		}
+
+		if (this->VoxelLayout == Enums::Scanline)
+		{
+			this->Voxels = Other.Voxels;
+			return;
+		}
+
+		this->Voxels.Resize(StorageResolution);
+
+		ReorderVoxels(Other.Voxels.GetData(), this->Resolution, VoxelOffsets.GetData(), this->Voxels.GetData());
+
+		this->Voxels.TimeStamp = Other.Voxels.TimeStamp;
+	}
+#endif
+	
+	/*! Advances the next sample of a ray over empty space, over the empty parts of the sparse voxel tree first and then depending on the accelerator type
+		@param[in] O Ray origin
+		@param[in] D Ray direction
+		@param[in,out] T Parametric distance of the next sample, stays on the sampling lattice
+		@param[in] StepSize Step size
+		@param[in] MaxT Maximum parametric distance
+		@return Whether \a T was advanced
+	*/
+	HOST_DEVICE bool SkipEmptySpace(const Vec3f& O, const Vec3f& D, float& T, const float& StepSize, const float& MaxT) const
+	{
+#ifdef ER_CPU
+		const bool Skipped = this->Sparse.Skip(O, D, T, StepSize, MaxT);
+#else
+		const bool Skipped = false;
+#endif
+
+		switch (this->AcceleratorType)
+		{
+			case Enums::Octree:			return this->Octree.Skip(O, D, T, StepSize, MaxT) || Skipped;
+			case Enums::MacrocellGrid:	return this->Macrocells.Skip(O, D, T, StepSize, MaxT) || Skipped;
+			default:					return Skipped;
+		}
+	}
+
+	/*! Gets an upper bound of the opacity along the segment from \a P0 to \a P1, only the octree provides a bound
+		@param[in] P0 Start of the segment
+		@param[in] P1 End of the segment
+		@return Upper bound of the opacity, FLT_MAX if there is no bound
+	*/
+	HOST_DEVICE float GetMaxOpacity(const Vec3f& P0, const Vec3f& P1) const
+	{
+		if (this->AcceleratorType == Enums::Octree)
+			return this->Octree.GetMaxOpacity(P0, P1);
+
+		return FLT_MAX;
+	}
+
+	/*! Updates the accelerators and, when \a VolumeProperty asks for pre-classification, the classified opacities for the opacity transfer function of \a VolumeProperty. Nothing is done unless the transfer function changed since the last classification (see its time stamp), the voxels changed or a tracer with a different opacity transfer function renders the volume. The classification is keyed by the nodes of the transfer function, so tracers with equal opacity transfer functions share it
+		@param[in] VolumeProperty Volume property with the opacity transfer function
+		@return Whether the classified opacities changed
+	*/
+	HOST bool Classify(const VolumeProperty& VolumeProperty)
+	{
+		const ScalarTransferFunction1D& Opacity = VolumeProperty.GetOpacity1D();
+
+		const bool OpacityChanged = this->ClassificationStale || !this->GetClassified() || !this->ClassifiedOpacity.HasSameNodes(Opacity);
+
+		if (OpacityChanged)
+		{
+			this->Macrocells.Classify(Opacity);
+			this->Octree.Classify(this->Macrocells);
+#ifdef ER_CPU
+			this->Sparse.Classify(Opacity);
+#endif
+
+			this->ClassifiedOpacity		= Opacity;
+			this->ClassificationStale	= false;
+		}
+
+#ifdef ER_CPU
+		// Streamed voxels are not classified, the brick cache only holds part of them
+		const Enums::OpacityClassification Classification = this->Bricks.GetEnabled() ? Enums::PostClassification : VolumeProperty.GetOpacityClassification();
+
+		if (Classification == Enums::PostClassification)
+		{
+			const bool Changed = this->Classified.GetEnabled();
+
+			this->Classified.Free();
+
+			return Changed;
+		}
+
+		if (!OpacityChanged && this->Classified.GetClassification() == Classification)
+			return false;
+
+		this->VisitSampler(ClassifyVisitor(this->Classified, this->Resolution, Opacity, Classification));
+
+		return true;
+#else
+		return false;
+#endif
+	}
+
+#ifdef ER_CPU
+	/*! Quantizes the voxels to 8 bits over the intensity window of the transfer functions of \a VolumeProperty, unless the quantized voxels are up to date. Streamed voxels are not quantized, the brick cache only holds part of them
+		@param[in] VolumeProperty Volume property with the transfer functions
+		@return Whether the quantized voxels changed
+	*/
+	HOST bool Quantize(const VolumeProperty& VolumeProperty)
+	{
+		if (this->Bricks.GetEnabled())
+		{
+			const bool Changed = this->Quantized.GetEnabled();
+
+			this->Quantized.Free();
+
+			return Changed;
+		}
+
+		const Vec2f Window = QuantizedVoxels::GetWindow(this->Histogram, VolumeProperty);
+
+		if (this->Quantized.GetEnabled() && this->QuantizedTimeStamp == this->Voxels.TimeStamp && this->Quantized.GetWindow() == Window)
+			return false;
+
+		this->VisitSampler(QuantizeVisitor(this->Quantized, this->Resolution, Window));
+
+		this->QuantizedTimeStamp = this->Voxels.TimeStamp;
+
+		return true;
+	}
+#endif
+
+	/*! Runs the preprocessing pass over the voxels of \a Other and updates the statistics, the accelerators and the gradient volume. The pass is skipped when neither the voxels nor the need for a gradient volume changed, or when its products are found in the cache directory of \a Other
+		@param[in] Other Host volume
+	*/
+	HOST void Preprocess(const HostVolume& Other)
+	{
+		const Vec3i Resolution = Other.GetResolution();
+
+		const VoxelSource Voxels = Other.GetVoxelSource();
+
+#ifdef ER_CPU
+		// Streamed voxels are only read by the preprocessing pass itself, hashing them for the cache would read all of them once more and their gradients would not fit the memory budget
+		const bool Streamed = this->Bricks.GetEnabled();
+#else
+		const bool Streamed = false;
+#endif
+
+		const bool BuildGradients = !Streamed && GradientVolume::FitsBudget(Resolution, Other.GetGradientBudget());
+
+		if (this->PreprocessedVoxels != Other.GetVoxelsTimeStamp() || BuildGradients != this->Gradients.GetBuilt())
+		{
+			VolumePreprocessor Preprocessor;
+
+			if (!Streamed && Other.GetCacheDirectory()[0] != '\0')
+			{
+				const unsigned long long Key = HashVolume(Voxels, Other.GetSpacing());
+
+				char FileName[MAX_CHAR_SIZE];
+
+				VolumeCache::GetFileName(Other.GetCacheDirectory(), Key, FileName);
+
+				if (!VolumeCache::Load(FileName, Key, Resolution, BuildGradients, Preprocessor))
+				{
+					Preprocessor.Run(Voxels, Other.GetSpacing(), BuildGradients);
+					VolumeCache::Save(FileName, Key, Resolution, Preprocessor);
+				}
+			}
+			else
+			{
+				Preprocessor.Run(Voxels, Other.GetSpacing(), BuildGradients);
+			}
+
+			this->Histogram.Set(Enums::Host, Preprocessor.GetHistogram().GetResolution(), Preprocessor.GetHistogram().GetData());
+			this->Macrocells.SetRanges(Preprocessor.GetMinIntensity(), Preprocessor.GetMaxIntensity(), Other.GetVoxelsTimeStamp());
+			this->Gradients.Set(Preprocessor.GetGradients());
+
+			this->MaxGradientMagnitude	= Preprocessor.GetMaxGradientMagnitude();
+			this->PreprocessedVoxels	= Other.GetVoxelsTimeStamp();
+		}
+
+		this->Macrocells.SetGeometry(Resolution, this->BoundingBox);
+		this->Octree.Build(this->Macrocells);
+#ifdef ER_CPU
+		this->Sparse.SetGeometry(this->BoundingBox);
+#endif
+	}
+
+	/*! Gets whether the accelerators have been classified
+		@return Whether the accelerators have been classified
+	*/
+	HOST bool GetClassified() const
+	{
+		return this->Macrocells.GetClassified() && this->Octree.GetClassified();
+	}
+
+	/*! Gets the voxel data at \a P
+		@param[in] P Position
+		@return Data at \a XYZ volume
+	*/
+	DEVICE unsigned short GetIntensity(const Vec3f& P)
+	{
+		return (*this)(P);
+	}
+	
+	/*! Gets the voxel data at \a P from the pyramid level whose voxels are about as large as \a Footprint, or from the quantized voxels at full resolution. Pyramid samples are clamped to the intensity range of their macrocell, so their opacity never exceeds the majorant of delta tracking. Only the CPU renderer has a pyramid and quantized voxels
+		@param[in] P Position
+		@param[in] Footprint Size of the region the sample represents in world units
+		@param[in] TextureID CUDA texture ID
+		@param[in] UseQuantized Whether to sample the quantized voxels when they exist
+		@return Data at \a P
+	*/
+	DEVICE unsigned short GetIntensity(const Vec3f& P, const float& Footprint, const int& TextureID = 0, const bool& UseQuantized = false)
+	{
+#ifdef ER_CPU
+		const int Level = this->Pyramid.GetLevel(Footprint / this->MinStep);
+
+		if (Level > 0)
+			return this->Macrocells.ClampIntensity(P, this->Pyramid.Fetch(Level, this->GetVoxelCoordinates((P - this->BoundingBox.GetMinP()) * this->InvSize), this->Voxels.GetFilterMode() == Enums::NearestNeighbour));
+
+		if (UseQuantized && this->Quantized.GetEnabled())
+			return this->Quantized.Fetch(this->GetVoxelCoordinates((P - this->BoundingBox.GetMinP()) * this->InvSize), this->Voxels.GetFilterMode() == Enums::NearestNeighbour);
+#endif
+
+		return (*this)(P, TextureID);
+	}
+	
+#ifdef ER_CPU
+	/*! Gets the classified opacity at \a P, see Classify
+		@param[in] P Position
+		@return Opacity at \a P
+	*/
+	HOST_DEVICE float GetClassifiedOpacity(const Vec3f& P) const
+	{
+		return this->Classified.Fetch(this->GetVoxelCoordinates((P - this->BoundingBox.GetMinP()) * this->InvSize), this->Voxels.GetFilterMode() == Enums::NearestNeighbour);
+	}
+#endif
+
+	/*! Computes the gradient at \a P using central differences
+		@param[in] P Position at which to compute the gradient
+		@return Gradient at \a P
+	*/
+	DEVICE Vec3f GradientCD(const Vec3f& P)
+	{
+#ifdef ER_CPU
+		if (this->Voxels.GetFilterMode() == Enums::Linear && !this->Bricks.GetEnabled())
+		{
+			const Vec3f UVW = this->GetVoxelCoordinates((P - this->BoundingBox.GetMinP()) * this->InvSize);
+
+			return this->VisitSampler(GradientVisitor(UVW));
+		}
+#endif
+
+		const float Intensity[3][2] = 
+		{
+			{ GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)), GetIntensity(P - Vec3f(this->Spacing[0], 0.0f, 0.0f)) },
+			{ GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)), GetIntensity(P - Vec3f(0.0f, this->Spacing[1], 0.0f)) },
+			{ GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2])), GetIntensity(P - Vec3f(0.0f, 0.0f, this->Spacing[2])) }
+		};
+
+		return Vec3f(Intensity[0][1] - Intensity[0][0], Intensity[1][1] - Intensity[1][0], Intensity[2][1] - Intensity[2][0]);
+	}
+	
+	/*! Computes the gradient at \a P using forward differences
+		@param[in] P Position at which to compute the gradient
+		@return Gradient at \a P
+	*/
+	DEVICE Vec3f GradientFD(const Vec3f& P)
+	{
+		const float Intensity[4] = 
+		{
+			GetIntensity(P),
+			GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)),
+			GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)),
+			GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2]))
+		};
+
+		return Vec3f(Intensity[0] - Intensity[1], Intensity[0] - Intensity[2], Intensity[0] - Intensity[3]);
+	}
+	
+	/*! Computes the filtered gradient at \a P using central differences
+		@param[in] P Position at which to compute the gradient
+		@return Gradient at \a P
+	*/
+	DEVICE Vec3f GradientFiltered(const Vec3f& P)
+	{
+		Vec3f Offset(Vec3f(this->Spacing[0], 0.0f, 0.0f)[0], Vec3f(0.0f, this->Spacing[1], 0.0f)[1], Vec3f(0.0f, 0.0f, this->Spacing[2])[2]);
+
+		const Vec3f G0 = GradientCD(P);
+		const Vec3f G1 = GradientCD(P + Vec3f(-Offset[0], -Offset[1], -Offset[2]));
+		const Vec3f G2 = GradientCD(P + Vec3f( Offset[0],  Offset[1],  Offset[2]));
+		const Vec3f G3 = GradientCD(P + Vec3f(-Offset[0],  Offset[1], -Offset[2]));
+		const Vec3f G4 = GradientCD(P + Vec3f( Offset[0], -Offset[1],  Offset[2]));
+		const Vec3f G5 = GradientCD(P + Vec3f(-Offset[0], -Offset[1],  Offset[2]));
+		const Vec3f G6 = GradientCD(P + Vec3f( Offset[0],  Offset[1], -Offset[2]));
+		const Vec3f G7 = GradientCD(P + Vec3f(-Offset[0],  Offset[1],  Offset[2]));
+		const Vec3f G8 = GradientCD(P + Vec3f( Offset[0], -Offset[1], -Offset[2]));
+	    
+		const Vec3f L0 = Lerp(0.5f, Lerp(0.5f, G1, G2), Lerp(0.5f, G3, G4));
+		const Vec3f L1 = Lerp(0.5f, Lerp(0.5f, G5, G6), Lerp(0.5f, G7, G8));
+	    
+		return Lerp(0.75f, G0, Lerp(0.5f, L0, L1));
+	}
+	
+	/*! Computes the gradient at \a P using \a GradientMode
+		@param[in] P Position at which to compute the gradient
+		@param[in] GradientMode Type of gradient computation
+		@return Gradient at \a P
+	*/
+	DEVICE Vec3f Gradient(const Vec3f& P, const Enums::GradientMode& GradientMode)
+	{
+		switch (GradientMode)
+		{
+			case Enums::ForwardDifferences:		return GradientFD(P);
+			case Enums::CentralDifferences:		return GradientCD(P);
+			case Enums::Filtered:				return GradientFiltered(P);
+		}
+
+		return GradientFD(P);
+	}
+	
+	/*! Computes the normalized gradient at \a P using \a GradientMode
+		@param[in] P Position at which to compute the gradient
+		@param[in] GradientMode Type of gradient computation
+		@return Gradient at \a P
+	*/
+	DEVICE Vec3f NormalizedGradient(const Vec3f& P, const Enums::GradientMode& GradientMode)
+	{
+		if (GradientMode == Enums::CentralDifferences && this->Gradients.GetBuilt())
+			return this->Gradients.GetNormal((P - this->BoundingBox.GetMinP()) * this->InvSize);
+
+		return Normalize(Gradient(P, GradientMode));
+	}
+	
+	/*! Computes the gradient magnitude at \a P
+		@param[in] P Position at which to compute the gradient magnitude
+		@return Gradient magnitude at \a P
+	*/
+	DEVICE float GradientMagnitude(const Vec3f& P)
+	{
+		if (this->Gradients.GetBuilt())
+			return this->Gradients.GetMagnitude((P - this->BoundingBox.GetMinP()) * this->InvSize);
+
+#ifdef ER_CPU
+		if (this->Voxels.GetFilterMode() == Enums::Linear && !this->Bricks.GetEnabled())
+			return 0.5f * this->GradientCD(P).Length();
+#endif
+
+		const Vec3f HalfSpacing = 0.5f / this->Spacing;
+
+		float D = 0.0f, Sum = 0.0f;
+
+		D = (GetIntensity(P + Vec3f(this->Spacing[0], 0.0f, 0.0f)) - GetIntensity(P - Vec3f(this->Spacing[0], 0.0f, 0.0f))) * 0.5f;
+		Sum += D * D;
+
+		D = (GetIntensity(P + Vec3f(0.0f, this->Spacing[1], 0.0f)) - GetIntensity(P - Vec3f(0.0f, this->Spacing[1], 0.0f))) * 0.5f;
+		Sum += D * D;
+
+		D = (GetIntensity(P + Vec3f(0.0f, 0.0f, this->Spacing[2])) - GetIntensity(P - Vec3f(0.0f, 0.0f, this->Spacing[2]))) * 0.5f;
+		Sum += D * D;
+
+		return sqrtf(Sum);
+	}
+	
+	Transform						Transform;					/*! Transform of the volume */
+	BoundingBox						BoundingBox;				/*! Encompassing bounding box */
+	Vec3f							Spacing;					/*! Voxel spacing */
+	Vec3f							InvSpacing;					/*! Inverse voxel spacing */
+	Vec3f							Size;						/*! Volume size */
+	Vec3f							InvSize;					/*! Inverse volume size */
+	float							MinStep;					/*! Minimum step size */
+#ifdef ER_CPU
+	Buffer3D<unsigned short>		Voxels;						/*! Voxel 3D buffer, in the voxel layout */
+	Buffer3D<unsigned char>			NativeVoxels;				/*! Voxels of the other voxel types as bytes, in the voxel layout */
+	Enums::VoxelType				VoxelType;					/*! Type of the voxels */
+	float							NativeMin;					/*! Minimum of floating point voxels */
+	float							NativeScale;				/*! Scale of floating point voxels, see GetIntensityScale */
+	Vec3i							Resolution;					/*! Resolution of the volume, the voxel buffer is padded for bricked layouts */
+	Enums::VoxelLayout				VoxelLayout;				/*! Order of the voxels in memory */
+	Buffer1D<int>					VoxelOffsets;				/*! Per axis memory offset tables of the voxel layout */
+	BrickCache						Bricks;						/*! Brick cache of streamed voxels, the voxel buffer is empty while it is enabled */
+	CompressedVoxels				Compressed;					/*! Compressed voxels of the compressed voxel layout, the voxel buffer is empty while they are enabled */
+	SparseVoxels					Sparse;						/*! Sparse voxel tree of the sparse voxel layout, the voxel buffer is empty while it is enabled */
+	QuantizedVoxels					Quantized;					/*! 8-bit copy of the voxels for interactive sampling */
+	TimeStamp						QuantizedTimeStamp;			/*! Time stamp of the voxels the quantized voxels were made from */
+	ClassifiedVoxels				Classified;					/*! Opacities classified per voxel for pre-classified sampling */
+	VolumePyramid					Pyramid;					/*! Mip pyramid for level of detail sampling */
+#else
+	CudaTexture3D<unsigned short>	Voxels;						/*! Voxel 3D buffer */
+#endif
+	Enums::AcceleratorType			AcceleratorType;			/*! Type of ray traversal accelerator */
+	MacrocellGrid					Macrocells;					/*! Min/max macrocell grid for empty space skipping */
+	Octree							Octree;						/*! Min/max octree for empty space skipping and opacity bounds */
+	GradientVolume					Gradients;					/*! Precomputed gradients, empty when disabled or over budget */
+	Buffer1D<unsigned long long>	Histogram;					/*! Intensity histogram */
+	TimeStamp						PreprocessedVoxels;			/*! Time stamp of the voxels the preprocessing pass ran on */
+	float							MaxGradientMagnitude;		/*! Maximum gradient magnitude */
+	ScalarTransferFunction1D		ClassifiedOpacity;			/*! Opacity transfer function the volume was classified for */
+	bool							ClassificationStale;		/*! Whether the volume has to be classified again */
+};
+
+}
@@ -0,0 +1,310 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "volumepreprocessor.h"
+#include "log.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <stdio.h>
+#include <vector>
+
+namespace ExposureRender
+{
+
+#define VOLUME_CACHE_MAGIC			0x43565245
+#define VOLUME_CACHE_VERSION		2
+#define VOLUME_CACHE_ALIGNMENT		64
+
+/*! Mixes \a Value into hash \a Hash
+	@param[in] Hash Hash
+	@param[in] Value Value to mix in
+	@return Mixed hash
+*/
+HOST inline unsigned long long MixHash(const unsigned long long& Hash, const unsigned long long& Value)
+{
+	unsigned long long H = (Hash ^ Value) * 0x9E3779B97F4A7C15ull;
+
+	return H ^ (H >> 29);
+}
+
+/*! Computes a 64 bit key of the voxel data, resolution and spacing of a volume, slabs of the voxels are hashed in parallel
+	@param[in] Voxels Host voxels in scanline order, of any voxel type
+	@param[in] Spacing Voxel spacing
+	@return Key
+*/
+HOST inline unsigned long long HashVolume(const VoxelSource& Voxels, const Vec3f& Spacing)
+{
+	const Vec3i Resolution = Voxels.GetResolution();
+
+	const long long NoVoxels	= Resolution.LongCumulativeProduct();
+	const int NoSlabs			= max(Resolution[2], 1);
+	const int VoxelSize			= GetVoxelSize(Voxels.GetVoxelType());
+	const int NoWordVoxels		= (int)sizeof(unsigned long long) / VoxelSize;
+
+	std::vector<unsigned long long> SlabHashes(NoSlabs);
+
+	const auto HashSlab = [&](int Z)
+	{
+		const long long Begin	= NoVoxels * Z / NoSlabs;
+		const long long End		= NoVoxels * (Z + 1) / NoSlabs;
+
+		const unsigned char* pVoxels = Voxels.GetBytes() + Begin * VoxelSize;
+
+		const long long NoWords = (End - Begin) / NoWordVoxels;
+
+		// Four independent lanes hide the latency of the multiplications
+		unsigned long long Lanes[4] = { 1, 2, 3, 4 };
+
+		long long i = 0;
+
+		for (; i + 4 <= NoWords; i += 4)
+		{
+			for (int l = 0; l < 4; l++)
+			{
+				unsigned long long Word;
+				memcpy(&Word, pVoxels + (i + l) * sizeof(Word), sizeof(Word));
+				Lanes[l] = MixHash(Lanes[l], Word);
+			}
+		}
+
+		unsigned long long Hash = MixHash(MixHash(Lanes[0], Lanes[1]), MixHash(Lanes[2], Lanes[3]));
+
+		for (long long v = i * NoWordVoxels; v < End - Begin; v++)
+		{
+			unsigned long long Value = 0;
+			memcpy(&Value, pVoxels + v * VoxelSize, VoxelSize);
+			Hash = MixHash(Hash, Value);
+		}
+
+		SlabHashes[Z] = Hash;
+	};
+
+#ifdef ER_CPU
+	Cpu::ThreadPool::Get().Run(NoSlabs, HashSlab);
+#else
+	for (int Z = 0; Z < NoSlabs; Z++)
+		HashSlab(Z);
+#endif
+
+	unsigned long long Key = 0;
+
+	for (int i = 0; i < 3; i++)
+	{
+		const float SpacingValue = Spacing[i];
+
+		unsigned int SpacingBits;
+		memcpy(&SpacingBits, &SpacingValue, sizeof(SpacingBits));
+
+		Key = MixHash(Key, (unsigned long long)Resolution[i]);
+		Key = MixHash(Key, SpacingBits);
+	}
+
+	for (int Z = 0; Z < NoSlabs; Z++)
+		Key = MixHash(Key, SlabHashes[Z]);
+
+	// Keys of unsigned short voxels do not depend on the voxel type, so existing cache files stay valid
+	if (Voxels.GetVoxelType() != Enums::UnsignedShort)
+		Key = MixHash(Key, (unsigned long long)Voxels.GetVoxelType());
+
+	return Key;
+}
+
+/*! Header of a volume cache file. The header and every section start at a multiple of VOLUME_CACHE_ALIGNMENT bytes so that the file can be memory mapped, the sections follow the header in the order of the section sizes */
+struct VolumeCacheHeader
+{
+	unsigned int		Magic;							/*! VOLUME_CACHE_MAGIC */
+	unsigned int		Version;						/*! VOLUME_CACHE_VERSION */
+	unsigned long long	Key;							/*! Key of the volume, see HashVolume */
+	int					Resolution[3];					/*! Resolution of the volume */
+	int					GridResolution[3];				/*! Resolution of the macrocell grid */
+	float				MaxGradientMagnitude;			/*! Maximum gradient magnitude */
+	unsigned int		HasGradients;					/*! Whether the file contains the packed gradients */
+	long long			SectionSizes[4];				/*! Size in bytes of the minimum intensities, maximum intensities, histogram and gradients */
+};
+
+/*! \class VolumeCache
+ * \brief Persists the products of the VolumePreprocessor in a file named after the key of the volume, so reopening a volume skips the preprocessing pass
+ */
+class EXPOSURE_RENDER_DLL VolumeCache
+{
+public:
+	/*! Gets the name of the cache file of the volume with \a Key
+		@param[in] pDirectory Cache directory
+		@param[in] Key Key of the volume
+		@param[out] pFileName File name, MAX_CHAR_SIZE characters
+	*/
+	HOST static void GetFileName(const char* pDirectory, const unsigned long long& Key, char* pFileName)
+	{
+		sprintf_s(pFileName, MAX_CHAR_SIZE, "%s/%016llx.ervc", pDirectory, Key);
+	}
+
+	/*! Loads the preprocessing products from \a pFileName, fails when the file does not exist, is invalid, belongs to a different volume or lacks requested gradients
+		@param[in] pFileName Cache file name
+		@param[in] Key Key of the volume
+		@param[in] Resolution Resolution of the volume
+		@param[in] LoadGradients Whether the packed gradients are needed
+		@param[out] Preprocessor Preprocessor which receives the products
+		@return Whether the products were loaded
+	*/
+	HOST static bool Load(const char* pFileName, const unsigned long long& Key, const Vec3i& Resolution, const bool& LoadGradients, VolumePreprocessor& Preprocessor)
+	{
+		FILE* pFile = fopen(pFileName, "rb");
+
+		if (!pFile)
+			return false;
+
+		VolumeCacheHeader Header;
+
+		bool Valid = ReadSection(pFile, &Header, sizeof(Header));
+
+		Valid = Valid && Header.Magic == VOLUME_CACHE_MAGIC && Header.Version == VOLUME_CACHE_VERSION && Header.Key == Key;
+		Valid = Valid && Vec3i(Header.Resolution[0], Header.Resolution[1], Header.Resolution[2]) == Resolution;
+		Valid = Valid && (Header.HasGradients || !LoadGradients);
+
+		if (Valid)
+		{
+			const Vec3i GridResolution(Header.GridResolution[0], Header.GridResolution[1], Header.GridResolution[2]);
+
+			Preprocessor.MinIntensity.Resize(GridResolution);
+			Preprocessor.MaxIntensity.Resize(GridResolution);
+			Preprocessor.Histogram.Resize(Vec<int, 1>(USHRT_MAX + 1));
+
+			if (LoadGradients)
+				Preprocessor.Gradients.Resize(Resolution);
+			else
+				Preprocessor.Gradients.Free();
+
+			Valid = Valid && Header.SectionSizes[0] == Preprocessor.MinIntensity.GetNoBytes() && ReadSection(pFile, Preprocessor.MinIntensity.GetData(), Header.SectionSizes[0]);
+			Valid = Valid && Header.SectionSizes[1] == Preprocessor.MaxIntensity.GetNoBytes() && ReadSection(pFile, Preprocessor.MaxIntensity.GetData(), Header.SectionSizes[1]);
+			Valid = Valid && Header.SectionSizes[2] == Preprocessor.Histogram.GetNoBytes() && ReadSection(pFile, Preprocessor.Histogram.GetData(), Header.SectionSizes[2]);
+
+			if (LoadGradients)
+				Valid = Valid && Header.SectionSizes[3] == Preprocessor.Gradients.GetNoBytes() && ReadSection(pFile, Preprocessor.Gradients.GetData(), Header.SectionSizes[3]);
+
+			Preprocessor.MaxGradientMagnitude = Header.MaxGradientMagnitude;
+		}
+
+		fclose(pFile);
+
+		if (!Valid)
+			DebugLog("Ignoring volume cache file %s", pFileName);
+
+		return Valid;
+	}
+
+	/*! Saves the preprocessing products to \a pFileName, the file is written under a temporary name and renamed when complete so that readers never see a partial file
+		@param[in] pFileName Cache file name
+		@param[in] Key Key of the volume
+		@param[in] Resolution Resolution of the volume
+		@param[in] Preprocessor Preprocessor which holds the products
+		@return Whether the products were saved
+	*/
+	HOST static bool Save(const char* pFileName, const unsigned long long& Key, const Vec3i& Resolution, VolumePreprocessor& Preprocessor)
+	{
+		char TemporaryFileName[MAX_CHAR_SIZE];
+
+		sprintf_s(TemporaryFileName, MAX_CHAR_SIZE, "%s.tmp", pFileName);
+
+		FILE* pFile = fopen(TemporaryFileName, "wb");
+
+		if (!pFile)
+		{
+			DebugLog("Unable to write volume cache file %s", TemporaryFileName);
+			return false;
+		}
+
+		VolumeCacheHeader Header;
+
+		memset(&Header, 0, sizeof(Header));
+
+		Header.Magic					= VOLUME_CACHE_MAGIC;
+		Header.Version					= VOLUME_CACHE_VERSION;
+		Header.Key						= Key;
+		Header.MaxGradientMagnitude		= Preprocessor.MaxGradientMagnitude;
+		Header.HasGradients				= Preprocessor.Gradients.GetNoElements() > 0;
+		Header.SectionSizes[0]			= Preprocessor.MinIntensity.GetNoBytes();
+		Header.SectionSizes[1]			= Preprocessor.MaxIntensity.GetNoBytes();
+		Header.SectionSizes[2]			= Preprocessor.Histogram.GetNoBytes();
+		Header.SectionSizes[3]			= Header.HasGradients ? Preprocessor.Gradients.GetNoBytes() : 0;
+
+		for (int i = 0; i < 3; i++)
+		{
+			Header.Resolution[i]		= Resolution[i];
+			Header.GridResolution[i]	= Preprocessor.MinIntensity.GetResolution()[i];
+		}
+
+		bool Written = WriteSection(pFile, &Header, sizeof(Header));
+
+		Written = Written && WriteSection(pFile, Preprocessor.MinIntensity.GetData(), Header.SectionSizes[0]);
+		Written = Written && WriteSection(pFile, Preprocessor.MaxIntensity.GetData(), Header.SectionSizes[1]);
+		Written = Written && WriteSection(pFile, Preprocessor.Histogram.GetData(), Header.SectionSizes[2]);
+		Written = Written && WriteSection(pFile, Preprocessor.Gradients.GetData(), Header.SectionSizes[3]);
+
+		Written = fclose(pFile) == 0 && Written;
+
+		remove(pFileName);
+
+		if (!Written || rename(TemporaryFileName, pFileName) != 0)
+		{
+			remove(TemporaryFileName);
+			DebugLog("Unable to write volume cache file %s", pFileName);
+			return false;
+		}
+
+		return true;
+	}
+
+protected:
+	/*! Reads a section of \a Size bytes and skips the padding up to the next section
+		@param[in] pFile File
+		@param[out] pData Section data
+		@param[in] Size Size of the section in bytes
+		@return Whether the section was read
+	*/
+	HOST static bool ReadSection(FILE* pFile, void* pData, const long long& Size)
+	{
+		char Padding[VOLUME_CACHE_ALIGNMENT];
+
+		const size_t NoPaddingBytes = (size_t)((VOLUME_CACHE_ALIGNMENT - Size % VOLUME_CACHE_ALIGNMENT) % VOLUME_CACHE_ALIGNMENT);
+
+		return fread(pData, 1, (size_t)Size, pFile) == (size_t)Size && fread(Padding, 1, NoPaddingBytes, pFile) == NoPaddingBytes;
+	}
+
+	/*! Writes a section of \a Size bytes followed by padding up to the next section
+		@param[in] pFile File
+		@param[in] pData Section data
+		@param[in] Size Size of the section in bytes
+		@return Whether the section was written
+	*/
+	HOST static bool WriteSection(FILE* pFile, const void* pData, const long long& Size)
+	{
+		char Padding[VOLUME_CACHE_ALIGNMENT];
+
+		memset(Padding, 0, sizeof(Padding));
+
+		const size_t NoPaddingBytes = (size_t)((VOLUME_CACHE_ALIGNMENT - Size % VOLUME_CACHE_ALIGNMENT) % VOLUME_CACHE_ALIGNMENT);
+
+		return fwrite(pData, 1, (size_t)Size, pFile) == (size_t)Size && fwrite(Padding, 1, NoPaddingBytes, pFile) == NoPaddingBytes;
+	}
+};
+
+}
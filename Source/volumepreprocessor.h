@@ -0,0 +1,206 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer1d.h"
+#include "buffer3d.h"
+#include "gradientvolume.h"
+#include "macrocellgrid.h"
+#include "voxeltype.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+#include <mutex>
+
+namespace ExposureRender
+{
+
+/*! \class VolumePreprocessor
+ * \brief Computes everything the renderer derives from the voxels in a single pass. The volume is processed in blocks of MACROCELL_SIZE^3 voxels plus a one voxel apron, which provides both the conservative macrocell ranges and the neighbours for central differences, so every block is read from memory once while it is in cache
+ */
+class EXPOSURE_RENDER_DLL VolumePreprocessor
+{
+public:
+	/*! Default constructor */
+	HOST VolumePreprocessor() :
+		MinIntensity("Preprocessed Minimum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxIntensity("Preprocessed Maximum Intensity", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		Histogram("Preprocessed Histogram", Enums::Host),
+		Gradients("Preprocessed Gradients", Enums::Host, Enums::NearestNeighbour, Enums::Clamp),
+		MaxGradientMagnitude(0.0f)
+	{
+	}
+
+	/*! Runs the preprocessing pass
+		@param[in] Voxels Host voxels in scanline order, of any voxel type
+		@param[in] Spacing Voxel spacing, used for the maximum gradient magnitude
+		@param[in] BuildGradients Whether to compute the packed gradients
+	*/
+	HOST void Run(const VoxelSource& Voxels, const Vec3f& Spacing, const bool& BuildGradients)
+	{
+		const Vec3i Resolution = Voxels.GetResolution();
+
+		Vec3i GridResolution;
+
+		for (int i = 0; i < 3; i++)
+			GridResolution[i] = (Resolution[i] + MACROCELL_SIZE - 1) / MACROCELL_SIZE;
+
+		this->MinIntensity.Resize(GridResolution);
+		this->MaxIntensity.Resize(GridResolution);
+		this->Histogram.Resize(Vec<int, 1>(USHRT_MAX + 1));
+		this->Histogram.Reset();
+
+		if (BuildGradients)
+			this->Gradients.Resize(Resolution);
+		else
+			this->Gradients.Free();
+
+		this->MaxGradientMagnitude = 0.0f;
+
+		const Vec3f HalfInvSpacing = 0.5f / Spacing;
+
+		std::mutex Mutex;
+
+		const auto ProcessSlab = [&](int Z)
+		{
+			const int BlockSize = MACROCELL_SIZE + 2;
+
+			unsigned short Block[MACROCELL_SIZE + 2][MACROCELL_SIZE + 2][MACROCELL_SIZE + 2];
+
+			std::vector<unsigned int> Histogram(USHRT_MAX + 1, 0);
+
+			float MaxSquaredGradientMagnitude = 0.0f;
+
+			for (int Y = 0; Y < GridResolution[1]; Y++)
+			{
+				for (int X = 0; X < GridResolution[0]; X++)
+				{
+					const int Origin[3] = { X * MACROCELL_SIZE - 1, Y * MACROCELL_SIZE - 1, Z * MACROCELL_SIZE - 1 };
+
+					// Load the block and its apron, clamped to the volume like the renderer's fetches. The cell range covers the apron so that every trilinear sample inside the cell lies within it
+					unsigned short MinIntensity = USHRT_MAX, MaxIntensity = 0;
+
+					const bool InteriorX = Origin[0] >= 0 && Origin[0] + BlockSize <= Resolution[0];
+
+					for (int z = 0; z < BlockSize; z++)
+					{
+						for (int y = 0; y < BlockSize; y++)
+						{
+							const int VoxelY = Clamp(Origin[1] + y, 0, Resolution[1] - 1);
+							const int VoxelZ = Clamp(Origin[2] + z, 0, Resolution[2] - 1);
+
+							const long long Row = ((long long)VoxelZ * Resolution[1] + VoxelY) * Resolution[0];
+
+							unsigned short* pBlock = Block[z][y];
+
+							if (InteriorX)
+							{
+								Voxels.Read(Row + Origin[0], BlockSize, pBlock);
+							}
+							else
+							{
+								for (int x = 0; x < BlockSize; x++)
+									Voxels.Read(Row + Clamp(Origin[0] + x, 0, Resolution[0] - 1), 1, pBlock + x);
+							}
+
+							for (int x = 0; x < BlockSize; x++)
+							{
+								MinIntensity = min(MinIntensity, pBlock[x]);
+								MaxIntensity = max(MaxIntensity, pBlock[x]);
+							}
+						}
+					}
+
+					this->MinIntensity(X, Y, Z) = MinIntensity;
+					this->MaxIntensity(X, Y, Z) = MaxIntensity;
+
+					const int Extent[3] =
+					{
+						min(MACROCELL_SIZE, Resolution[0] - X * MACROCELL_SIZE),
+						min(MACROCELL_SIZE, Resolution[1] - Y * MACROCELL_SIZE),
+						min(MACROCELL_SIZE, Resolution[2] - Z * MACROCELL_SIZE)
+					};
+
+					for (int z = 1; z <= Extent[2]; z++)
+					{
+						for (int y = 1; y <= Extent[1]; y++)
+						{
+							unsigned int* pGradients = BuildGradients ? this->Gradients.GetData() + ((long long)(Origin[2] + z) * Resolution[1] + Origin[1] + y) * Resolution[0] + Origin[0] : NULL;
+
+							for (int x = 1; x <= Extent[0]; x++)
+							{
+								Histogram[Block[z][y][x]]++;
+
+								// Central differences pointing towards lower intensities, like Volume::GradientCD
+								const int D[3] =
+								{
+									(int)Block[z][y][x - 1] - (int)Block[z][y][x + 1],
+									(int)Block[z][y - 1][x] - (int)Block[z][y + 1][x],
+									(int)Block[z - 1][y][x] - (int)Block[z + 1][y][x]
+								};
+
+								const float G[3] = { (float)D[0] * HalfInvSpacing[0], (float)D[1] * HalfInvSpacing[1], (float)D[2] * HalfInvSpacing[2] };
+
+								MaxSquaredGradientMagnitude = max(MaxSquaredGradientMagnitude, G[0] * G[0] + G[1] * G[1] + G[2] * G[2]);
+
+								if (BuildGradients)
+									pGradients[x] = GradientVolume::Pack(Vec3f((float)D[0], (float)D[1], (float)D[2]));
+							}
+						}
+					}
+				}
+			}
+
+			std::unique_lock<std::mutex> Lock(Mutex);
+
+			unsigned long long* pHistogram = this->Histogram.GetData();
+
+			for (int i = 0; i <= USHRT_MAX; i++)
+				pHistogram[i] += Histogram[i];
+
+			this->MaxGradientMagnitude = max(this->MaxGradientMagnitude, sqrtf(MaxSquaredGradientMagnitude));
+		};
+
+#ifdef ER_CPU
+		Cpu::ThreadPool::Get().Run(GridResolution[2], ProcessSlab);
+#else
+		for (int Z = 0; Z < GridResolution[2]; Z++)
+			ProcessSlab(Z);
+#endif
+	}
+
+	GET_REF_MACRO(HOST, MinIntensity, Buffer3D<unsigned short>)
+	GET_REF_MACRO(HOST, MaxIntensity, Buffer3D<unsigned short>)
+	GET_REF_MACRO(HOST, Histogram, Buffer1D<unsigned long long>)
+	GET_REF_MACRO(HOST, Gradients, Buffer3D<unsigned int>)
+	GET_MACRO(HOST, MaxGradientMagnitude, float)
+
+protected:
+	Buffer3D<unsigned short>		MinIntensity;				/*! Minimum intensity per macrocell, including the apron */
+	Buffer3D<unsigned short>		MaxIntensity;				/*! Maximum intensity per macrocell, including the apron */
+	Buffer1D<unsigned long long>	Histogram;					/*! Intensity histogram of the volume, 64-bit counts since streamed volumes can exceed 2^32 voxels */
+	Buffer3D<unsigned int>			Gradients;					/*! Packed gradients, empty unless requested */
+	float							MaxGradientMagnitude;		/*! Exact maximum gradient magnitude in intensity per unit length */
+
+	friend class VolumeCache;
+};
+
+}
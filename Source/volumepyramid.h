@@ -0,0 +1,228 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "buffer1d.h"
+#include "voxellayout.h"
+#include "voxelsampler.h"
+#include "voxeltype.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+#include <vector>
+#include <algorithm>
+
+namespace ExposureRender
+{
+
+#define VOLUME_PYRAMID_MAX_LEVELS	8
+
+/*! Box filters scanline ordered voxels by \a Factor along each axis, partial boxes at the borders average the voxels they cover
+	@param[in] Source Scanline ordered voxels, of any voxel type
+	@param[in] Factor Number of voxels per filtered voxel along each axis
+	@param[out] pDestination Filtered voxels, the resolution divided by \a Factor and rounded up
+*/
+HOST inline void DownsampleVoxels(const VoxelSource& Source, const int& Factor, unsigned short* pDestination)
+{
+	const Vec3i Resolution = Source.GetResolution();
+
+	const Vec3i DestinationResolution((Resolution[0] + Factor - 1) / Factor, (Resolution[1] + Factor - 1) / Factor, (Resolution[2] + Factor - 1) / Factor);
+
+	const auto DownsampleSlice = [&](int Z)
+	{
+		std::vector<unsigned long long> Sums(DestinationResolution[0]);
+		std::vector<int> Counts(DestinationResolution[0]);
+		std::vector<unsigned short> Row(Resolution[0]);
+
+		for (int Y = 0; Y < DestinationResolution[1]; Y++)
+		{
+			std::fill(Sums.begin(), Sums.end(), 0);
+			std::fill(Counts.begin(), Counts.end(), 0);
+
+			for (int z = Z * Factor; z < min((Z + 1) * Factor, Resolution[2]); z++)
+			{
+				for (int y = Y * Factor; y < min((Y + 1) * Factor, Resolution[1]); y++)
+				{
+					Source.ReadRow(y, z, Row.data());
+
+					for (int x = 0; x < Resolution[0]; x++)
+					{
+						Sums[x / Factor] += Row[x];
+						Counts[x / Factor]++;
+					}
+				}
+			}
+
+			unsigned short* pDestinationRow = pDestination + ((long long)Z * DestinationResolution[1] + Y) * DestinationResolution[0];
+
+			for (int X = 0; X < DestinationResolution[0]; X++)
+				pDestinationRow[X] = (unsigned short)((Sums[X] + Counts[X] / 2) / Counts[X]);
+		}
+	};
+
+#ifdef ER_CPU
+	Cpu::ThreadPool::Get().Run(DestinationResolution[2], DownsampleSlice);
+#else
+	for (int Z = 0; Z < DestinationResolution[2]; Z++)
+		DownsampleSlice(Z);
+#endif
+}
+
+/*! \class VolumePyramid
+ * \brief Mip pyramid of a volume for level of detail sampling. Level zero is the volume itself, every next level halves the resolution with a box filter. All levels are stored scanline ordered in a single buffer
+ */
+class EXPOSURE_RENDER_DLL VolumePyramid
+{
+public:
+	/*! Default constructor */
+	HOST VolumePyramid() :
+		NoLevels(1),
+		Voxels("Device Pyramid Voxels", Enums::Device),
+		Offsets("Device Pyramid Voxel Offsets", Enums::Device),
+		PyramidVoxels()
+	{
+	}
+
+	/*! Builds levels one to \a NoLevels - 1 from the full resolution voxels, nothing is built when neither the voxels nor the number of levels changed
+		@param[in] Voxels Scanline ordered full resolution voxels, of any voxel type
+		@param[in] VoxelsTimeStamp Time stamp of the voxels
+		@param[in] NoLevels Number of levels including the full resolution, one releases the pyramid
+	*/
+	HOST void Build(const VoxelSource& Voxels, const TimeStamp& VoxelsTimeStamp, const int& NoLevels)
+	{
+		const Vec3i Resolution = Voxels.GetResolution();
+
+		int NoUsefulLevels = 1;
+
+		while (NoUsefulLevels < VOLUME_PYRAMID_MAX_LEVELS && (Resolution[0] >> (NoUsefulLevels - 1)) > 1 && (Resolution[1] >> (NoUsefulLevels - 1)) > 1 && (Resolution[2] >> (NoUsefulLevels - 1)) > 1)
+			NoUsefulLevels++;
+
+		const int NoBuiltLevels = Clamp(NoLevels, 1, NoUsefulLevels);
+
+		if (this->PyramidVoxels == VoxelsTimeStamp && this->NoLevels == NoBuiltLevels)
+			return;
+
+		this->NoLevels		= NoBuiltLevels;
+		this->PyramidVoxels	= VoxelsTimeStamp;
+
+		if (this->NoLevels <= 1)
+		{
+			this->Voxels.Free();
+			this->Offsets.Free();
+			return;
+		}
+
+		long long NoVoxels = 0;
+		int NoOffsets = 0;
+
+		this->Resolution[0] = Resolution;
+
+		for (int i = 1; i < this->NoLevels; i++)
+		{
+			for (int j = 0; j < 3; j++)
+				this->Resolution[i][j] = (this->Resolution[i - 1][j] + 1) / 2;
+
+			this->VoxelsStart[i]	= NoVoxels;
+			this->OffsetsStart[i]	= NoOffsets;
+
+			NoVoxels	+= this->Resolution[i].CumulativeProduct();
+			NoOffsets	+= this->Resolution[i][0] + this->Resolution[i][1] + this->Resolution[i][2];
+		}
+
+		Buffer1D<unsigned short> PyramidVoxels("Host Pyramid Voxels", Enums::Host);
+		Buffer1D<int> Offsets("Host Pyramid Voxel Offsets", Enums::Host);
+
+		PyramidVoxels.Resize(Vec<int, 1>((int)NoVoxels));
+		Offsets.Resize(Vec<int, 1>(NoOffsets));
+
+		for (int i = 1; i < this->NoLevels; i++)
+		{
+			const VoxelSource Source = i == 1 ? Voxels : VoxelSource(PyramidVoxels.GetData() + this->VoxelsStart[i - 1], this->Resolution[i - 1]);
+
+			DownsampleVoxels(Source, 2, PyramidVoxels.GetData() + this->VoxelsStart[i]);
+
+			Vec3i StorageResolution;
+
+			ComputeVoxelOffsets(Enums::Scanline, this->Resolution[i], StorageResolution, Offsets.GetData() + this->OffsetsStart[i]);
+		}
+
+		this->Voxels.Set(Enums::Host, PyramidVoxels.GetResolution(), PyramidVoxels.GetData());
+		this->Offsets.Set(Enums::Host, Offsets.GetResolution(), Offsets.GetData());
+	}
+
+	/*! Gets the level whose voxels are about as large as a footprint, the footprint is rounded down to a power of two
+		@param[in] Footprint Footprint in voxels of the full resolution
+		@return Level
+	*/
+	HOST_DEVICE int GetLevel(const float& Footprint) const
+	{
+		union
+		{
+			float			F;
+			unsigned int	I;
+		} Bits;
+
+		Bits.F = Footprint;
+
+		// The exponent of a positive float is the rounded down base two logarithm
+		const int Exponent = (int)((Bits.I >> 23) & 0xff) - 127;
+
+		return Clamp(Exponent, 0, this->NoLevels - 1);
+	}
+
+	/*! Gets a sampler for \a Level
+		@param[in] Level Level, at least one
+		@return Voxel sampler
+	*/
+	HOST_DEVICE VoxelSampler GetSampler(const int& Level) const
+	{
+		return VoxelSampler(this->Voxels.GetData() + this->VoxelsStart[Level], this->Offsets.GetData() + this->OffsetsStart[Level], this->Resolution[Level]);
+	}
+
+	/*! Fetches voxel data from \a Level
+		@param[in] Level Level, at least one
+		@param[in] UVW Voxel coordinates of the full resolution volume
+		@param[in] Nearest Whether to fetch the nearest voxel instead of interpolating
+		@return Data at \a UVW
+	*/
+	HOST_DEVICE float Fetch(const int& Level, const Vec3f& UVW, const bool& Nearest) const
+	{
+		const float InvScale = 1.0f / (float)(1 << Level);
+
+		const Vec3f LevelUVW((UVW[0] + 0.5f) * InvScale - 0.5f, (UVW[1] + 0.5f) * InvScale - 0.5f, (UVW[2] + 0.5f) * InvScale - 0.5f);
+
+		const VoxelSampler Sampler = this->GetSampler(Level);
+
+		return Nearest ? (float)Sampler.Nearest(LevelUVW) : Sampler(LevelUVW);
+	}
+
+	GET_MACRO(HOST_DEVICE, NoLevels, int)
+
+protected:
+	int							NoLevels;								/*! Number of levels including the full resolution */
+	Vec3i						Resolution[VOLUME_PYRAMID_MAX_LEVELS];	/*! Resolution per level */
+	long long					VoxelsStart[VOLUME_PYRAMID_MAX_LEVELS];	/*! Index of the first voxel per level */
+	int							OffsetsStart[VOLUME_PYRAMID_MAX_LEVELS];	/*! Index of the first offset table entry per level */
+	Buffer1D<unsigned short>	Voxels;									/*! Voxels of levels one and up */
+	Buffer1D<int>				Offsets;								/*! Offset tables of levels one and up */
+	TimeStamp					PyramidVoxels;							/*! Time stamp of the voxels the pyramid was built from */
+};
+
+}
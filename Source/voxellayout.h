@@ -0,0 +1,195 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vector.h"
+#include "enums.h"
+#include "voxeltype.h"
+
+#ifdef ER_CPU
+	#include "threadpool.h"
+#endif
+
+namespace ExposureRender
+{
+
+#define VOXEL_BRICK_SIZE_LOG2		3
+#define VOXEL_BRICK_SIZE			(1 << VOXEL_BRICK_SIZE_LOG2)
+#define SPARSE_NODE_SIZE_LOG2		4
+#define SPARSE_NODE_SIZE			(1 << SPARSE_NODE_SIZE_LOG2)
+#define SPARSE_ROOT_SHIFT			(3 * (VOXEL_BRICK_SIZE_LOG2 + SPARSE_NODE_SIZE_LOG2))
+
+/*! Spreads the bits of \a Value so that there are two zero bits between consecutive bits (three-dimensional Morton code)
+	@param[in] Value Value to spread
+	@return Spread value
+*/
+HOST_DEVICE inline int SpreadBits(const int& Value)
+{
+	int Spread = 0;
+
+	for (int i = 0; i < VOXEL_BRICK_SIZE_LOG2; i++)
+		Spread |= ((Value >> i) & 1) << (3 * i);
+
+	return Spread;
+}
+
+/*! Computes the memory offset tables of a voxel layout. The index of voxel (x, y, z) is the sum of one entry per axis, Offsets[x] + Offsets[Rx + y] + Offsets[Rx + Ry + z], which holds for the scanline layout as well as for bricks that are Morton ordered internally and stored in scanline order
+	@param[in] VoxelLayout Voxel layout
+	@param[in] Resolution Resolution of the volume
+	@param[out] StorageResolution Resolution of the storage, the resolution rounded up to whole bricks for the bricked and sparse layouts
+	@param[out] pOffsets Offset tables, Rx + Ry + Rz elements
+*/
+HOST inline void ComputeVoxelOffsets(const Enums::VoxelLayout& VoxelLayout, const Vec3i& Resolution, Vec3i& StorageResolution, int* pOffsets)
+{
+	switch (VoxelLayout)
+	{
+		case Enums::Scanline:
+		{
+			StorageResolution = Resolution;
+
+			int Stride = 1;
+
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < Resolution[i]; j++)
+					pOffsets[j] = j * Stride;
+
+				pOffsets	+= Resolution[i];
+				Stride		*= Resolution[i];
+			}
+
+			break;
+		}
+
+		case Enums::Bricked:
+		case Enums::Compressed:
+		{
+			const int NoBrickVoxels = VOXEL_BRICK_SIZE * VOXEL_BRICK_SIZE * VOXEL_BRICK_SIZE;
+
+			int Stride = NoBrickVoxels;
+
+			for (int i = 0; i < 3; i++)
+			{
+				const int NoBricks = (Resolution[i] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE;
+
+				StorageResolution[i] = NoBricks * VOXEL_BRICK_SIZE;
+
+				for (int j = 0; j < Resolution[i]; j++)
+					pOffsets[j] = (j >> VOXEL_BRICK_SIZE_LOG2) * Stride + (SpreadBits(j & (VOXEL_BRICK_SIZE - 1)) << i);
+
+				pOffsets	+= Resolution[i];
+				Stride		*= NoBricks;
+			}
+
+			break;
+		}
+
+		case Enums::Sparse:
+		{
+			// Leaf voxel bits, then the leaf within its internal node, then the internal node in the root grid (see SparseVoxelReader)
+			int Stride = 1 << SPARSE_ROOT_SHIFT;
+
+			for (int i = 0; i < 3; i++)
+			{
+				const int NoLeaves	= (Resolution[i] + VOXEL_BRICK_SIZE - 1) / VOXEL_BRICK_SIZE;
+				const int NoNodes	= (NoLeaves + SPARSE_NODE_SIZE - 1) / SPARSE_NODE_SIZE;
+
+				StorageResolution[i] = NoLeaves * VOXEL_BRICK_SIZE;
+
+				for (int j = 0; j < Resolution[i]; j++)
+				{
+					const int Leaf = j >> VOXEL_BRICK_SIZE_LOG2;
+
+					pOffsets[j] = (Leaf >> SPARSE_NODE_SIZE_LOG2) * Stride + ((Leaf & (SPARSE_NODE_SIZE - 1)) << (3 * VOXEL_BRICK_SIZE_LOG2 + i * SPARSE_NODE_SIZE_LOG2)) + (SpreadBits(j & (VOXEL_BRICK_SIZE - 1)) << i);
+				}
+
+				pOffsets	+= Resolution[i];
+				Stride		*= NoNodes;
+			}
+
+			break;
+		}
+	}
+}
+
+/*! Visits the voxels of a brick of VOXEL_BRICK_SIZE^3 voxels in Morton order, voxels beyond the volume repeat the border
+	@param[in] Voxels Scanline ordered voxels
+	@param[in] X Brick x index
+	@param[in] Y Brick y index
+	@param[in] Z Brick z index
+	@param[in] Visit Called with the Morton index of the voxel within the brick and its intensity
+*/
+template<class F>
+HOST void VisitVoxelBrick(const VoxelSource& Voxels, const int& X, const int& Y, const int& Z, F Visit)
+{
+	const Vec3i Resolution = Voxels.GetResolution();
+
+	const int X0		= X * VOXEL_BRICK_SIZE;
+	const int NoVoxels	= min(VOXEL_BRICK_SIZE, Resolution[0] - X0);
+
+	unsigned short Row[VOXEL_BRICK_SIZE];
+
+	for (int z = 0; z < VOXEL_BRICK_SIZE; z++)
+	{
+		const int VZ = min(Z * VOXEL_BRICK_SIZE + z, Resolution[2] - 1);
+
+		for (int y = 0; y < VOXEL_BRICK_SIZE; y++)
+		{
+			const int VY = min(Y * VOXEL_BRICK_SIZE + y, Resolution[1] - 1);
+
+			Voxels.Read(((long long)VZ * Resolution[1] + VY) * Resolution[0] + X0, NoVoxels, Row);
+
+			for (int x = 0; x < VOXEL_BRICK_SIZE; x++)
+				Visit(SpreadBits(x) | (SpreadBits(y) << 1) | (SpreadBits(z) << 2), Row[min(x, NoVoxels - 1)]);
+		}
+	}
+}
+
+/*! Copies scanline ordered voxels into another layout
+	@param[in] pSource Scanline ordered voxels
+	@param[in] Resolution Resolution of the volume
+	@param[in] pOffsets Offset tables of the destination layout, see ComputeVoxelOffsets
+	@param[out] pDestination Destination voxels
+*/
+template<class T>
+HOST void ReorderVoxels(const T* pSource, const Vec3i& Resolution, const int* pOffsets, T* pDestination)
+{
+	const int* pOffsetsY = pOffsets + Resolution[0];
+	const int* pOffsetsZ = pOffsetsY + Resolution[1];
+
+	const auto ReorderSlice = [&](int Z)
+	{
+		const T* pSlice = pSource + (long long)Z * Resolution[0] * Resolution[1];
+
+		for (int Y = 0; Y < Resolution[1]; Y++)
+		{
+			const int Offset = pOffsetsZ[Z] + pOffsetsY[Y];
+
+			for (int X = 0; X < Resolution[0]; X++)
+				pDestination[Offset + pOffsets[X]] = pSlice[Y * Resolution[0] + X];
+		}
+	};
+
+#ifdef ER_CPU
+	Cpu::ThreadPool::Get().Run(Resolution[2], ReorderSlice);
+#else
+	for (int Z = 0; Z < Resolution[2]; Z++)
+		ReorderSlice(Z);
+#endif
+}
+
+}
@@ -0,0 +1,271 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vector.h"
+
+namespace ExposureRender
+{
+
+/*! \class BasicVoxelSampler
+ * \brief Fixed point trilinear sampler for unsigned short voxels, the interpolation weights have eight fractional bits like the CUDA texture unit. Voxels are addressed through per axis offset tables (see ComputeVoxelOffsets) so that the sampler works for every voxel layout. \a T is anything that can be indexed with a voxel index, a pointer for uncompressed voxels
+ */
+template<class T>
+class BasicVoxelSampler
+{
+public:
+	/*! Constructor
+		@param[in] pVoxels Voxels
+		@param[in] pOffsets Per axis offset tables of the voxel layout
+		@param[in] Resolution Resolution of the voxels
+	*/
+	HOST_DEVICE BasicVoxelSampler(const T& pVoxels, const int* pOffsets, const Vec3i& Resolution) :
+		pVoxels(pVoxels)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			this->pOffsets[i]	= pOffsets;
+			this->Max[i]		= (float)(Resolution[i] - 1);
+			this->MaxBase[i]	= max(Resolution[i] - 2, 0);
+			this->Step[i]		= Resolution[i] > 1 ? 1 : 0;
+
+			pOffsets += Resolution[i];
+		}
+	}
+
+	/*! Locates voxel coordinate \a U along \a Axis, this is the only place where coordinates are clamped
+		@param[in] U Voxel coordinate, voxel centers lie on integer coordinates
+		@param[in] Axis Axis
+		@param[out] Base Index of the lower voxel
+		@param[out] Weight Fixed point weight of the upper voxel, in [0, 256]
+	*/
+	HOST_DEVICE void Locate(const float& U, const int& Axis, int& Base, unsigned int& Weight) const
+	{
+		Locate(U, this->Max[Axis], this->MaxBase[Axis], Base, Weight);
+	}
+
+	/*! Locates voxel coordinate \a U on an axis with \a Max + 1 voxels
+		@param[in] U Voxel coordinate, voxel centers lie on integer coordinates
+		@param[in] Max Largest voxel coordinate
+		@param[in] MaxBase Largest lower cell corner
+		@param[out] Base Index of the lower voxel
+		@param[out] Weight Fixed point weight of the upper voxel, in [0, 256]
+	*/
+	HOST_DEVICE static void Locate(const float& U, const float& Max, const int& MaxBase, int& Base, unsigned int& Weight)
+	{
+		const float Clamped = min(max(U, 0.0f), Max);
+
+		Base	= min((int)Clamped, MaxBase);
+		Weight	= (unsigned int)((Clamped - (float)Base) * 256.0f + 0.5f);
+	}
+
+	/*! Interpolates the eight voxels of the cell which starts at \a Base
+		@param[in] Base Lower corner of the cell
+		@param[in] Wx Fixed point x weight
+		@param[in] Wy Fixed point y weight
+		@param[in] Wz Fixed point z weight
+		@return Interpolated value in 16.16 fixed point
+	*/
+	HOST_DEVICE unsigned int Interpolate(const int (&Base)[3], const unsigned int& Wx, const unsigned int& Wy, const unsigned int& Wz) const
+	{
+		const int X[2] = { this->pOffsets[0][Base[0]], this->pOffsets[0][Base[0] + this->Step[0]] };
+		const int Y[2] = { this->pOffsets[1][Base[1]], this->pOffsets[1][Base[1] + this->Step[1]] };
+		const int Z[2] = { this->pOffsets[2][Base[2]], this->pOffsets[2][Base[2] + this->Step[2]] };
+
+		return Trilinear(this->pVoxels, X, Y, Z, Wx, Wy, Wz);
+	}
+
+	/*! Interpolates eight voxels with fixed point weights, the voxel indices are the sums of one offset per axis
+		@param[in] pV Voxels
+		@param[in] X Lower and upper x offset
+		@param[in] Y Lower and upper y offset
+		@param[in] Z Lower and upper z offset
+		@param[in] Wx Fixed point x weight
+		@param[in] Wy Fixed point y weight
+		@param[in] Wz Fixed point z weight
+		@return Interpolated value in 16.16 fixed point
+	*/
+	template<class V>
+	HOST_DEVICE static unsigned int Trilinear(const V& pV, const int (&X)[2], const int (&Y)[2], const int (&Z)[2], const unsigned int& Wx, const unsigned int& Wy, const unsigned int& Wz)
+	{
+		const int X0 = X[0], X1 = X[1], Y0 = Y[0], Y1 = Y[1], Z0 = Z[0], Z1 = Z[1];
+
+		// 16.8
+		const unsigned int X00 = pV[Z0 + Y0 + X0] * (256 - Wx) + pV[Z0 + Y0 + X1] * Wx;
+		const unsigned int X10 = pV[Z0 + Y1 + X0] * (256 - Wx) + pV[Z0 + Y1 + X1] * Wx;
+		const unsigned int X01 = pV[Z1 + Y0 + X0] * (256 - Wx) + pV[Z1 + Y0 + X1] * Wx;
+		const unsigned int X11 = pV[Z1 + Y1 + X0] * (256 - Wx) + pV[Z1 + Y1 + X1] * Wx;
+
+		// 16.8
+		const unsigned int Y0W = (X00 * (256 - Wy) + X10 * Wy + 128) >> 8;
+		const unsigned int Y1W = (X01 * (256 - Wy) + X11 * Wy + 128) >> 8;
+
+		// 16.16
+		return Y0W * (256 - Wz) + Y1W * Wz;
+	}
+
+	/*! Samples the voxels at \a UVW
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@return Interpolated value
+	*/
+	HOST_DEVICE float operator()(const Vec3f& UVW) const
+	{
+		int Base[3];
+		unsigned int Weight[3];
+
+		for (int i = 0; i < 3; i++)
+			this->Locate(UVW[i], i, Base[i], Weight[i]);
+
+		return (float)this->Interpolate(Base, Weight[0], Weight[1], Weight[2]) * (1.0f / 65536.0f);
+	}
+
+	/*! Gets the voxel nearest to \a UVW
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@return Voxel value
+	*/
+	HOST_DEVICE unsigned short Nearest(const Vec3f& UVW) const
+	{
+		int XYZ[3];
+
+		for (int i = 0; i < 3; i++)
+			XYZ[i] = Clamp((int)floorf(UVW[i] + 0.5f), 0, (int)this->Max[i]);
+
+		return this->GetVoxel(XYZ);
+	}
+
+	/*! Computes central differences at \a UVW, one voxel apart, with the same conventions as Volume::GradientCD (intensities are truncated, the difference points towards lower intensities)
+		@param[in] UVW Voxel coordinates, voxel centers lie on integer coordinates
+		@return Central differences
+	*/
+	HOST_DEVICE Vec3f CentralDifferences(const Vec3f& UVW) const
+	{
+		int Base[3];
+		unsigned int Weight[3];
+
+		bool Interior = true;
+
+		for (int i = 0; i < 3; i++)
+		{
+			this->Locate(UVW[i], i, Base[i], Weight[i]);
+
+			Interior &= UVW[i] >= 1.0f && UVW[i] < this->Max[i] - 1.0f;
+		}
+
+		Vec3f Differences;
+
+		if (Interior)
+		{
+			// The neighbours share the weights of the center sample and only differ in their lower corner
+			for (int i = 0; i < 3; i++)
+			{
+				int Neighbour[3] = { Base[0], Base[1], Base[2] };
+
+				Neighbour[i] = Base[i] - 1;
+				const unsigned int Minus = this->Interpolate(Neighbour, Weight[0], Weight[1], Weight[2]) >> 16;
+
+				Neighbour[i] = Base[i] + 1;
+				const unsigned int Plus = this->Interpolate(Neighbour, Weight[0], Weight[1], Weight[2]) >> 16;
+
+				Differences[i] = (float)Minus - (float)Plus;
+			}
+		}
+		else
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				Vec3f Minus = UVW, Plus = UVW;
+
+				Minus[i]	-= 1.0f;
+				Plus[i]		+= 1.0f;
+
+				Differences[i] = (float)(unsigned short)(*this)(Minus) - (float)(unsigned short)(*this)(Plus);
+			}
+		}
+
+		return Differences;
+	}
+
+	/*! Gets the voxel at \a XYZ
+		@param[in] XYZ Voxel index
+		@return Voxel value
+	*/
+	HOST_DEVICE unsigned short GetVoxel(const int (&XYZ)[3]) const
+	{
+		return this->pVoxels[this->pOffsets[2][XYZ[2]] + this->pOffsets[1][XYZ[1]] + this->pOffsets[0][XYZ[0]]];
+	}
+
+protected:
+	T						pVoxels;		/*! Voxels */
+	const int*				pOffsets[3];	/*! Memory offset table per axis */
+	float					Max[3];			/*! Largest voxel coordinate per axis */
+	int						MaxBase[3];		/*! Largest lower cell corner per axis */
+	int						Step[3];		/*! Index step to the upper cell corner per axis, zero for single voxel axes */
+};
+
+typedef BasicVoxelSampler<const unsigned short*> VoxelSampler;
+
+/*! Sampler visitor which fetches a voxel value, nearest neighbour or trilinearly filtered */
+struct FetchVisitor
+{
+	typedef float Result;
+
+	/*! Constructor
+		@param[in] UVW Voxel coordinates
+		@param[in] Nearest Whether to fetch the nearest voxel
+	*/
+	HOST_DEVICE FetchVisitor(const Vec3f& UVW, const bool& Nearest) :
+		UVW(UVW),
+		Nearest(Nearest)
+	{
+	}
+
+	template<class T>
+	HOST_DEVICE float operator()(const BasicVoxelSampler<T>& Sampler) const
+	{
+		if (this->Nearest)
+			return (float)Sampler.Nearest(this->UVW);
+
+		return Sampler(this->UVW);
+	}
+
+	Vec3f	UVW;			/*! Voxel coordinates */
+	bool	Nearest;		/*! Whether to fetch the nearest voxel */
+};
+
+/*! Sampler visitor which computes the gradient with central differences */
+struct GradientVisitor
+{
+	typedef Vec3f Result;
+
+	/*! Constructor
+		@param[in] UVW Voxel coordinates
+	*/
+	HOST_DEVICE GradientVisitor(const Vec3f& UVW) :
+		UVW(UVW)
+	{
+	}
+
+	template<class T>
+	HOST_DEVICE Vec3f operator()(const BasicVoxelSampler<T>& Sampler) const
+	{
+		return Sampler.CentralDifferences(this->UVW);
+	}
+
+	Vec3f	UVW;			/*! Voxel coordinates */
+};
+
+}
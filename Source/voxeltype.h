@@ -0,0 +1,304 @@
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vector.h"
+#include "enums.h"
+
+namespace ExposureRender
+{
+
+/*! 16-bit floating point voxel, stored as its bits */
+struct HalfFloat
+{
+	unsigned short	Bits;		/*! Sign, exponent and mantissa bits */
+};
+
+/*! Converts a half precision float to single precision
+	@param[in] Value Half precision float
+	@return Single precision float
+*/
+HOST_DEVICE inline float ToFloat(const HalfFloat& Value)
+{
+	const unsigned int Sign		= (Value.Bits & 0x8000u) << 16;
+	const unsigned int Exponent	= (Value.Bits >> 10) & 0x1f;
+	const unsigned int Mantissa	= Value.Bits & 0x3ff;
+
+	union
+	{
+		float			F;
+		unsigned int	I;
+	} Bits;
+
+	if (Exponent == 0)
+	{
+		// Zero or subnormal
+		Bits.F = (float)Mantissa * (1.0f / 16777216.0f);
+		Bits.I |= Sign;
+	}
+	else if (Exponent == 0x1f)
+	{
+		Bits.I = Sign | 0x7f800000u | (Mantissa << 13);
+	}
+	else
+	{
+		Bits.I = Sign | ((Exponent + 112) << 23) | (Mantissa << 13);
+	}
+
+	return Bits.F;
+}
+
+/*! Converts a single precision float to itself
+	@param[in] Value Single precision float
+	@return \a Value
+*/
+HOST_DEVICE inline float ToFloat(const float& Value)
+{
+	return Value;
+}
+
+/*! \class VoxelTraits
+ * \brief Maps voxel values of type \a T to the 16-bit intensity domain of the renderer, in which the histogram, the accelerators and the baked transfer functions work. Unsigned integers keep their value, signed 16-bit integers are offset by 32768 and floating point values are spread linearly over the 16-bit domain from the minimum to the maximum of the volume. Transfer function nodes are given in native units and mapped with GetIntensityMapping
+ */
+template<class T>
+struct VoxelTraits;
+
+template<>
+struct VoxelTraits<unsigned char>
+{
+	static const Enums::VoxelType Type = Enums::UnsignedChar;
+
+	HOST_DEVICE static unsigned short ToIntensity(const unsigned char& Value, const float&, const float&)
+	{
+		return Value;
+	}
+};
+
+template<>
+struct VoxelTraits<short>
+{
+	static const Enums::VoxelType Type = Enums::Short;
+
+	HOST_DEVICE static unsigned short ToIntensity(const short& Value, const float&, const float&)
+	{
+		return (unsigned short)((int)Value + 32768);
+	}
+};
+
+template<>
+struct VoxelTraits<unsigned short>
+{
+	static const Enums::VoxelType Type = Enums::UnsignedShort;
+
+	HOST_DEVICE static unsigned short ToIntensity(const unsigned short& Value, const float&, const float&)
+	{
+		return Value;
+	}
+};
+
+template<>
+struct VoxelTraits<HalfFloat>
+{
+	static const Enums::VoxelType Type = Enums::Half;
+
+	HOST_DEVICE static unsigned short ToIntensity(const HalfFloat& Value, const float& Min, const float& Scale)
+	{
+		return (unsigned short)min(max((ToFloat(Value) - Min) * Scale + 0.5f, 0.0f), (float)USHRT_MAX);
+	}
+};
+
+template<>
+struct VoxelTraits<float>
+{
+	static const Enums::VoxelType Type = Enums::Float;
+
+	HOST_DEVICE static unsigned short ToIntensity(const float& Value, const float& Min, const float& Scale)
+	{
+		return (unsigned short)min(max((Value - Min) * Scale + 0.5f, 0.0f), (float)USHRT_MAX);
+	}
+};
+
+/*! Gets the size of a voxel of \a VoxelType
+	@param[in] VoxelType Voxel type
+	@return Size in bytes
+*/
+HOST_DEVICE inline int GetVoxelSize(const Enums::VoxelType& VoxelType)
+{
+	switch (VoxelType)
+	{
+		case Enums::UnsignedChar:	return 1;
+		case Enums::Float:			return 4;
+		default:					return 2;
+	}
+}
+
+/*! Gets the scale which maps the floating point range [\a Min, \a Max] to the 16-bit intensity domain
+	@param[in] Min Minimum value
+	@param[in] Max Maximum value
+	@return Scale
+*/
+HOST_DEVICE inline float GetIntensityScale(const float& Min, const float& Max)
+{
+	return Max > Min ? (float)USHRT_MAX / (Max - Min) : 1.0f;
+}
+
+/*! Gets the linear map from native voxel values of \a VoxelType to the 16-bit intensity domain, the unclamped and unrounded counterpart of VoxelTraits::ToIntensity
+	@param[in] VoxelType Voxel type
+	@param[in] Min Minimum of floating point voxels
+	@param[in] Scale Scale of floating point voxels, see GetIntensityScale
+	@return Scale and offset, an intensity is the value times the scale plus the offset
+*/
+HOST_DEVICE inline Vec2f GetIntensityMapping(const Enums::VoxelType& VoxelType, const float& Min, const float& Scale)
+{
+	switch (VoxelType)
+	{
+		case Enums::Short:	return Vec2f(1.0f, 32768.0f);
+		case Enums::Half:
+		case Enums::Float:	return Vec2f(Scale, -Min * Scale);
+		default:			return Vec2f(1.0f, 0.0f);
+	}
+}
+
+/*! \class NativeVoxelReader
+ * \brief Reads voxels of type \a T and maps them to the 16-bit intensity domain while sampling, so the voxels are stored in their native width
+ */
+template<class T>
+class NativeVoxelReader
+{
+public:
+	/*! Constructor
+		@param[in] pVoxels Voxels
+		@param[in] Min Minimum of floating point voxels
+		@param[in] Scale Scale of floating point voxels, see GetIntensityScale
+	*/
+	HOST_DEVICE NativeVoxelReader(const T* pVoxels, const float& Min, const float& Scale) :
+		pVoxels(pVoxels),
+		Min(Min),
+		Scale(Scale)
+	{
+	}
+
+	/*! Reads voxel \a ID
+		@param[in] ID Voxel index
+		@return Intensity
+	*/
+	HOST_DEVICE unsigned short operator[](const long long& ID) const
+	{
+		return VoxelTraits<T>::ToIntensity(this->pVoxels[ID], this->Min, this->Scale);
+	}
+
+protected:
+	const T*	pVoxels;		/*! Voxels */
+	float		Min;			/*! Minimum of floating point voxels */
+	float		Scale;			/*! Scale of floating point voxels */
+};
+
+/*! \class VoxelSource
+ * \brief Scanline ordered voxels of any voxel type, read as 16-bit intensities by the passes which derive data from the voxels
+ */
+class VoxelSource
+{
+public:
+	/*! Constructor
+		@param[in] pVoxels Voxels
+		@param[in] VoxelType Type of the voxels
+		@param[in] Resolution Resolution of the voxels
+		@param[in] Range Minimum and maximum of floating point voxels
+	*/
+	HOST VoxelSource(const void* pVoxels, const Enums::VoxelType& VoxelType, const Vec3i& Resolution, const Vec2f& Range = Vec2f(0.0f)) :
+		pVoxels(pVoxels),
+		VoxelType(VoxelType),
+		Resolution(Resolution),
+		Min(Range[0]),
+		Scale(GetIntensityScale(Range[0], Range[1]))
+	{
+	}
+
+	/*! Constructor for 16-bit unsigned voxels
+		@param[in] pVoxels Voxels
+		@param[in] Resolution Resolution of the voxels
+	*/
+	HOST VoxelSource(const unsigned short* pVoxels, const Vec3i& Resolution) :
+		pVoxels(pVoxels),
+		VoxelType(Enums::UnsignedShort),
+		Resolution(Resolution),
+		Min(0.0f),
+		Scale(1.0f)
+	{
+	}
+
+	/*! Reads consecutive voxels as intensities
+		@param[in] ID Index of the first voxel
+		@param[in] NoVoxels Number of voxels
+		@param[out] pIntensities Intensities
+	*/
+	HOST void Read(const long long& ID, const int& NoVoxels, unsigned short* pIntensities) const
+	{
+		switch (this->VoxelType)
+		{
+			case Enums::UnsignedChar:	this->Read<unsigned char>(ID, NoVoxels, pIntensities);	break;
+			case Enums::Short:			this->Read<short>(ID, NoVoxels, pIntensities);			break;
+			case Enums::Half:			this->Read<HalfFloat>(ID, NoVoxels, pIntensities);		break;
+			case Enums::Float:			this->Read<float>(ID, NoVoxels, pIntensities);			break;
+			default:					memcpy(pIntensities, (const unsigned short*)this->pVoxels + ID, NoVoxels * sizeof(unsigned short));
+		}
+	}
+
+	/*! Reads a row of voxels as intensities
+		@param[in] Y Y index of the row
+		@param[in] Z Z index of the row
+		@param[out] pIntensities Intensities, one per voxel of the row
+	*/
+	HOST void ReadRow(const int& Y, const int& Z, unsigned short* pIntensities) const
+	{
+		this->Read(((long long)Z * this->Resolution[1] + Y) * this->Resolution[0], this->Resolution[0], pIntensities);
+	}
+
+	/*! Gets the voxels as bytes
+		@return Voxel bytes
+	*/
+	HOST const unsigned char* GetBytes() const
+	{
+		return (const unsigned char*)this->pVoxels;
+	}
+
+	GET_MACRO(HOST, VoxelType, Enums::VoxelType)
+	GET_MACRO(HOST, Resolution, Vec3i)
+
+protected:
+	/*! Reads consecutive voxels of type \a T as intensities
+		@param[in] ID Index of the first voxel
+		@param[in] NoVoxels Number of voxels
+		@param[out] pIntensities Intensities
+	*/
+	template<class T>
+	HOST void Read(const long long& ID, const int& NoVoxels, unsigned short* pIntensities) const
+	{
+		const NativeVoxelReader<T> Reader((const T*)this->pVoxels + ID, this->Min, this->Scale);
+
+		for (int i = 0; i < NoVoxels; i++)
+			pIntensities[i] = Reader[i];
+	}
+
+	const void*				pVoxels;		/*! Voxels */
+	Enums::VoxelType		VoxelType;		/*! Type of the voxels */
+	Vec3i					Resolution;		/*! Resolution of the voxels */
+	float					Min;			/*! Minimum of floating point voxels */
+	float					Scale;			/*! Scale of floating point voxels */
+};
+
+}
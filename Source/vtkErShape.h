@@ -1,63 +1,63 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "vtkErAlignment.h"
-
-using namespace ExposureRender;
-
-class VTK_ER_EXPORT vtkErShape : public vtkErAlignment
-{
-public:
-	static vtkErShape* New();
-	vtkTypeRevisionMacro(vtkErShape, vtkErAlignment);
-
-	void RequestData(ExposureRender::Shape& Shape);
-
-	vtkGetMacro(OneSided, bool);
-	vtkSetMacro(OneSided, bool);
-
-	vtkGetMacro(ShapeType, Enums::ShapeType);
-	vtkSetMacro(ShapeType, Enums::ShapeType);
-
-	vtkGetVector3Macro(Size, float);
-	vtkSetVector3Macro(Size, float);
-	
-	vtkGetMacro(Radius, float);
-	vtkSetMacro(Radius, float);
-
-	vtkGetMacro(InnerRadius, float);
-	vtkSetMacro(InnerRadius, float);
-
-	vtkGetMacro(OuterRadius, float);
-	vtkSetMacro(OuterRadius, float);
-
-protected:
-	vtkErShape();
-	virtual ~vtkErShape() {};
-
-private:
-	vtkErShape(const vtkErShape& Other);		// Not implemented
-    void operator = (const vtkErShape& Other);  // Not implemented
-
-	bool				OneSided;
-	Enums::ShapeType	ShapeType;
-	float				Size[3];
-	float				Radius;
-	float				InnerRadius;
-	float				OuterRadius;
-};
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vtkErAlignment.h"
+
+using namespace ExposureRender;
+
+class VTK_ER_EXPORT vtkErShape : public vtkErAlignment
+{
+public:
+	static vtkErShape* New();
+	vtkTypeRevisionMacro(vtkErShape, vtkErAlignment);
+
+	void RequestData(ExposureRender::Shape& Shape);
+
+	vtkGetMacro(OneSided, bool);
+	vtkSetMacro(OneSided, bool);
+
+	vtkGetMacro(ShapeType, Enums::ShapeType);
+	vtkSetMacro(ShapeType, Enums::ShapeType);
+
+	vtkGetVector3Macro(Size, float);
+	vtkSetVector3Macro(Size, float);
+	
+	vtkGetMacro(Radius, float);
+	vtkSetMacro(Radius, float);
+
+	vtkGetMacro(InnerRadius, float);
+	vtkSetMacro(InnerRadius, float);
+
+	vtkGetMacro(OuterRadius, float);
+	vtkSetMacro(OuterRadius, float);
+
+protected:
+	vtkErShape();
+	virtual ~vtkErShape() {};
+
+private:
+	vtkErShape(const vtkErShape& Other);		// Not implemented
+    void operator = (const vtkErShape& Other);  // Not implemented
+
+	bool				OneSided;
+	Enums::ShapeType	ShapeType;
+	float				Size[3];
+	float				Radius;
+	float				InnerRadius;
+	float				OuterRadius;
+};
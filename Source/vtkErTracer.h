@@ -1,98 +1,106 @@
-/*
-*	@file
-*	@author  Thomas Kroes <t.kroes at tudelft.nl>
-*	@version 1.0
-*	
-*	@section LICENSE
-*	
-*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
-*	
-*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
-*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
-*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
-*
-*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#pragma once
-
-#include "vtkErDll.h"
-#include "vtkErBindable.h"
-#include "vtkErVolumeProperty.h"
-
-#include <vtkDataObject.h>
-#include <vtkVolumeMapper.h>
-#include <vtkSmartPointer.h>
-#include <vtkPiecewiseFunction.h>
-#include <vtkColorTransferFunction.h>
-#include <vtkTextActor.h>
-
-using namespace ExposureRender;
-
-class vtkErTracerData : public vtkDataObject, public vtkHostBindableTracer
-{
-public:
-	static vtkErTracerData* New();
-	vtkTypeRevisionMacro(vtkErTracerData, vtkDataObject);
-	
-protected:
-	vtkErTracerData() {};
-	virtual ~vtkErTracerData() {};
-
-private:
-	vtkErTracerData(const vtkErTracerData& Other);		// Not implemented.
-    void operator = (const vtkErTracerData& Other);		// Not implemented.
-};
-
-class VTK_ER_EXPORT vtkErTracer : public vtkAbstractVolumeMapper
-{
-public:
-	static vtkErTracer* New();
-	vtkTypeRevisionMacro(vtkErTracer, vtkAbstractVolumeMapper);
-
-	enum Ports
-	{
-		VolumesPort = 0,
-		ObjectsPort
-	};
-
-	vtkErVolumeProperty* GetVolumeProperty()						{	return this->VolumeProperty.GetPointer();										};
-	void SetVolumeProperty(vtkErVolumeProperty* VolumeProperty)		{	this->VolumeProperty = VolumeProperty; this->VolumeProperty->Modified();		};
-	
-	vtkGetMacro(RenderMode, Enums::RenderMode);
-	vtkSetMacro(RenderMode, Enums::RenderMode);
-
-	vtkGetMacro(NoiseReduction, bool);
-	vtkSetMacro(NoiseReduction, bool);
-
-	vtkGetMacro(ShowStatistics, bool);
-	vtkSetMacro(ShowStatistics, bool);
-
-protected:
-	vtkErTracer();
-    virtual ~vtkErTracer();
-
-	virtual int FillInputPortInformation(int Port, vtkInformation* Info);
-	virtual int FillOutputPortInformation(int Port, vtkInformation* Info);
-
-	virtual void BeforeRender(vtkRenderer* Renderer, vtkVolume* Volume);
-	virtual void Render(vtkRenderer* Renderer, vtkVolume* Volume);
-	virtual void AfterRender(vtkRenderer* Renderer, vtkVolume* Volume);
-
-private:
-	unsigned int							TextureID;
-	ExposureRender::ColorRGBAuc*			ImageBuffer;
-	Vec2i									LastRenderSize;
-	unsigned long							CameraTimeStamp;
-	Enums::RenderMode						RenderMode;
-	vtkSmartPointer<vtkErVolumeProperty>	VolumeProperty;
-	unsigned long							VolumePropertyTimeStamp;
-	unsigned long							TracerTimeStamp;
-	HostTracer								Tracer;
-	bool									NoiseReduction;
-	bool									ShowStatistics;
-	vtkSmartPointer<vtkTextActor>			NameTextActor;
-	vtkSmartPointer<vtkTextActor>			ValueTextActor;
-	vtkSmartPointer<vtkTextActor>			UnitTextActor;
-	Statistics								Statistics;
-};
+/*
+*	@file
+*	@author  Thomas Kroes <t.kroes at tudelft.nl>
+*	@version 1.0
+*	
+*	@section LICENSE
+*	
+*	Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+*	
+*	Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+*	Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+*	Neither the name of the TU Delft nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+*	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "vtkErDll.h"
+#include "vtkErBindable.h"
+#include "vtkErVolumeProperty.h"
+
+#include <vtkDataObject.h>
+#include <vtkVolumeMapper.h>
+#include <vtkSmartPointer.h>
+#include <vtkPiecewiseFunction.h>
+#include <vtkColorTransferFunction.h>
+#include <vtkTextActor.h>
+
+using namespace ExposureRender;
+
+class vtkErTracerData : public vtkDataObject, public vtkHostBindableTracer
+{
+public:
+	static vtkErTracerData* New();
+	vtkTypeRevisionMacro(vtkErTracerData, vtkDataObject);
+	
+protected:
+	vtkErTracerData() {};
+	virtual ~vtkErTracerData() {};
+
+private:
+	vtkErTracerData(const vtkErTracerData& Other);		// Not implemented.
+    void operator = (const vtkErTracerData& Other);		// Not implemented.
+};
+
+class VTK_ER_EXPORT vtkErTracer : public vtkAbstractVolumeMapper
+{
+public:
+	static vtkErTracer* New();
+	vtkTypeRevisionMacro(vtkErTracer, vtkAbstractVolumeMapper);
+
+	enum Ports
+	{
+		VolumesPort = 0,
+		ObjectsPort
+	};
+
+	vtkErVolumeProperty* GetVolumeProperty()						{	return this->VolumeProperty.GetPointer();										};
+	void SetVolumeProperty(vtkErVolumeProperty* VolumeProperty)		{	this->VolumeProperty = VolumeProperty; this->VolumeProperty->Modified();		};
+	
+	vtkGetMacro(RenderMode, Enums::RenderMode);
+	vtkSetMacro(RenderMode, Enums::RenderMode);
+
+	vtkGetMacro(NoiseReduction, bool);
+	vtkSetMacro(NoiseReduction, bool);
+
+	vtkGetMacro(ConvergenceThreshold, float);
+	vtkSetMacro(ConvergenceThreshold, float);
+
+	vtkGetMacro(TimeBudget, float);
+	vtkSetMacro(TimeBudget, float);
+
+	vtkGetMacro(ShowStatistics, bool);
+	vtkSetMacro(ShowStatistics, bool);
+
+protected:
+	vtkErTracer();
+    virtual ~vtkErTracer();
+
+	virtual int FillInputPortInformation(int Port, vtkInformation* Info);
+	virtual int FillOutputPortInformation(int Port, vtkInformation* Info);
+
+	virtual void BeforeRender(vtkRenderer* Renderer, vtkVolume* Volume);
+	virtual void Render(vtkRenderer* Renderer, vtkVolume* Volume);
+	virtual void AfterRender(vtkRenderer* Renderer, vtkVolume* Volume);
+
+private:
+	unsigned int							TextureID;
+	ExposureRender::ColorRGBAuc*			ImageBuffer;
+	Vec2i									LastRenderSize;
+	unsigned long							CameraTimeStamp;
+	Enums::RenderMode						RenderMode;
+	vtkSmartPointer<vtkErVolumeProperty>	VolumeProperty;
+	unsigned long							VolumePropertyTimeStamp;
+	unsigned long							TracerTimeStamp;
+	HostTracer								Tracer;
+	bool									NoiseReduction;
+	float									ConvergenceThreshold;
+	float									TimeBudget;
+	bool									ShowStatistics;
+	vtkSmartPointer<vtkTextActor>			NameTextActor;
+	vtkSmartPointer<vtkTextActor>			ValueTextActor;
+	vtkSmartPointer<vtkTextActor>			UnitTextActor;
+	Statistics								Statistics;
+};